@@ -0,0 +1,253 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Microbenchmarks that run the task bodies of cuNumeric directly on synthetic
+// rectangles and accessors, without launching the Legate runtime. Each task family
+// registers its cases into a Suite, which the driver in bench_main.cc runs and
+// reports as JSON.
+
+#include "legate.h"
+
+// The benchmarks only run the host variants, whose bodies are compiled into the
+// benchmark binary by including the variant sources. Hiding the GPU variants keeps
+// the task classes from referring to code that lives in the CUDA sources.
+#undef LEGATE_USE_CUDA
+
+#include "cunumeric/cunumeric.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef LEGATE_BOUNDS_CHECKS
+#error "The microbenchmarks bind accessors by hand and can't be built with bounds checks"
+#endif
+
+namespace cunumeric {
+namespace bench {
+
+using namespace legate;
+
+enum class Layout : int {
+  DENSE   = 0,
+  STRIDED = 1,
+};
+
+inline const char* layout_name(Layout layout)
+{
+  return layout == Layout::DENSE ? "dense" : "strided";
+}
+
+inline const char* variant_name(VariantKind kind)
+{
+  return kind == VariantKind::OMP ? "omp" : "cpu";
+}
+
+template <typename T>
+inline const char* type_name()
+{
+  if constexpr (std::is_same_v<T, bool>) return "bool";
+  if constexpr (std::is_same_v<T, int32_t>) return "int32";
+  if constexpr (std::is_same_v<T, int64_t>) return "int64";
+  if constexpr (std::is_same_v<T, float>) return "float32";
+  if constexpr (std::is_same_v<T, double>) return "float64";
+  return "unknown";
+}
+
+// Returns a rectangle of the given dimension with about `volume` points,
+// spread as evenly as possible over the dimensions
+template <int DIM>
+Rect<DIM> make_rect(size_t volume)
+{
+  auto extent = static_cast<coord_t>(std::pow(static_cast<double>(volume), 1.0 / DIM));
+  extent      = std::max<coord_t>(extent, 1);
+  Point<DIM> hi;
+  coord_t rest = static_cast<coord_t>(volume);
+  for (int32_t dim = 0; dim < DIM - 1; ++dim) {
+    hi[dim] = extent - 1;
+    rest    = std::max<coord_t>(rest / extent, 1);
+  }
+  hi[DIM - 1] = rest - 1;
+  return Rect<DIM>(Point<DIM>::ZEROES(), hi);
+}
+
+// Owns the allocation behind a synthetic store and binds accessors to it. With the
+// strided layout, the innermost dimension is padded to twice its extent so that the
+// accessors aren't dense and the task bodies take their sparse paths. Dimensions in
+// `broadcast_mask` get a zero stride, which is how promoted stores (e.g., the output
+// of an axis reduction) look to the task bodies.
+template <typename T, int DIM>
+class SyntheticStore {
+ public:
+  SyntheticStore(const Rect<DIM>& rect, Layout layout, uint32_t broadcast_mask = 0) : rect_(rect)
+  {
+    size_t pitch = sizeof(T);
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      if (broadcast_mask & (1U << dim)) {
+        strides_[dim] = 0;
+        continue;
+      }
+      strides_[dim] = pitch;
+      auto extent   = static_cast<size_t>(rect.hi[dim] - rect.lo[dim] + 1);
+      if (dim == DIM - 1 && layout == Layout::STRIDED) extent *= 2;
+      pitch *= extent;
+    }
+    size_ = pitch / sizeof(T);
+    data_ = std::make_unique<T[]>(size_);
+  }
+
+ public:
+  void fill_random(uint32_t seed = 0)
+  {
+    std::mt19937 gen(seed);
+    for (size_t idx = 0; idx < size_; ++idx) {
+      if constexpr (std::is_same_v<T, bool>)
+        data_[idx] = gen() & 1;
+      else if constexpr (std::is_integral_v<T>)
+        data_[idx] = static_cast<T>(gen() % 1000);
+      else
+        data_[idx] = static_cast<T>(std::uniform_real_distribution<double>(0.5, 1.5)(gen));
+    }
+  }
+
+  void fill(const T& value)
+  {
+    for (size_t idx = 0; idx < size_; ++idx) data_[idx] = value;
+  }
+
+  AccessorRO<T, DIM> read_accessor() const { return bind(AccessorRO<T, DIM>{}); }
+  AccessorWO<T, DIM> write_accessor() const { return bind(AccessorWO<T, DIM>{}); }
+  AccessorRW<T, DIM> read_write_accessor() const { return bind(AccessorRW<T, DIM>{}); }
+  template <typename REDOP, bool EXCLUSIVE>
+  AccessorRD<REDOP, EXCLUSIVE, DIM> reduce_accessor() const
+  {
+    static_assert(std::is_same_v<typename REDOP::RHS, T>);
+    return bind(AccessorRD<REDOP, EXCLUSIVE, DIM>{});
+  }
+
+  T* data() const { return data_.get(); }
+  size_t size() const { return size_; }
+  size_t bytes() const { return size_ * sizeof(T); }
+
+ private:
+  template <typename ACC>
+  ACC bind(ACC acc) const
+  {
+    uintptr_t base = reinterpret_cast<uintptr_t>(data_.get());
+    for (int32_t dim = 0; dim < DIM; ++dim) {
+      base -= rect_.lo[dim] * strides_[dim];
+      acc.accessor.strides[dim] = strides_[dim];
+    }
+    acc.accessor.base = base;
+    return acc;
+  }
+
+ private:
+  Rect<DIM> rect_;
+  Point<DIM> strides_;
+  size_t size_;
+  std::unique_ptr<T[]> data_;
+};
+
+// Sweep parameters shared by all task families
+struct Config {
+  size_t volume{1 << 22};
+  int32_t repeat{5};
+  std::vector<int32_t> thread_counts{1};
+  std::string filter{};
+};
+
+struct Case {
+  std::string family;
+  std::string op;
+  std::string variant;
+  std::string dtype;
+  std::string layout;
+  int32_t dim;
+  size_t volume;
+  // Bytes read and written by one run, used to report the bandwidth
+  size_t bytes;
+  // Only OpenMP cases are swept over thread counts
+  bool threaded;
+  // Allocates and initializes the stores of the case and returns a function that runs the
+  // task body once on them. The stores are freed when the returned function is destroyed,
+  // so only one case is resident at a time.
+  std::function<std::function<void()>()> prepare;
+};
+
+class Suite {
+ public:
+  void add(Case c) { cases_.push_back(std::move(c)); }
+  const std::vector<Case>& cases() const { return cases_; }
+
+ private:
+  std::vector<Case> cases_;
+};
+
+// Each task family registers its cases through one of these
+void register_unary_op_benchmarks(Suite& suite, const Config& config);
+void register_binary_op_benchmarks(Suite& suite, const Config& config);
+void register_unary_red_benchmarks(Suite& suite, const Config& config);
+void register_scan_benchmarks(Suite& suite, const Config& config);
+void register_sort_benchmarks(Suite& suite, const Config& config);
+
+// Adds a case for each layout and each dimension from MIN_DIM to 3. The factory is called
+// as `factory(std::integral_constant<int, DIM>{}, rect, layout)` when the case runs and
+// returns the runner of Case::prepare. Bodies that require dense stores set DENSE_ONLY.
+template <VariantKind KIND, int MIN_DIM = 1, bool DENSE_ONLY = false, typename Factory>
+void add_sweep(Suite& suite,
+               const Config& config,
+               const std::string& family,
+               const std::string& op,
+               const std::string& dtype,
+               size_t bytes_per_point,
+               Factory factory)
+{
+  auto add_dim = [&](auto dim) {
+    constexpr int DIM = decltype(dim)::value;
+    if constexpr (DIM >= MIN_DIM) {
+      auto rect     = make_rect<DIM>(config.volume);
+      size_t volume = rect.volume();
+      for (auto layout : {Layout::DENSE, Layout::STRIDED}) {
+        if (DENSE_ONLY && layout != Layout::DENSE) continue;
+        suite.add(Case{family,
+                       op,
+                       variant_name(KIND),
+                       dtype,
+                       layout_name(layout),
+                       DIM,
+                       volume,
+                       volume * bytes_per_point,
+                       KIND == VariantKind::OMP,
+                       [=]() { return factory(dim, rect, layout); }});
+      }
+    }
+  };
+  add_dim(std::integral_constant<int, 1>{});
+  add_dim(std::integral_constant<int, 2>{});
+  add_dim(std::integral_constant<int, 3>{});
+}
+
+}  // namespace bench
+}  // namespace cunumeric
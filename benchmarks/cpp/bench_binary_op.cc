@@ -0,0 +1,88 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+
+#include "cunumeric/binary/binary_op.cc"
+#ifdef LEGATE_USE_OPENMP
+#include "cunumeric/binary/binary_op_omp.cc"
+#endif
+
+namespace cunumeric {
+namespace bench {
+
+namespace {
+
+template <VariantKind KIND, BinaryOpCode OP_CODE, Type::Code CODE>
+void add_binary_op(Suite& suite, const Config& config, const char* op_name)
+{
+  using OP   = BinaryOp<OP_CODE, CODE>;
+  using RHS1 = legate_type_of<CODE>;
+  using RHS2 = rhs2_of_binary_op<OP_CODE, CODE>;
+  using LHS  = std::result_of_t<OP(RHS1, RHS2)>;
+
+  add_sweep<KIND>(
+    suite,
+    config,
+    "binary_op",
+    op_name,
+    type_name<RHS1>(),
+    sizeof(RHS1) + sizeof(RHS2) + sizeof(LHS),
+    [](auto dim, auto rect, Layout layout) {
+      constexpr int DIM = decltype(dim)::value;
+      auto in1          = std::make_shared<SyntheticStore<RHS1, DIM>>(rect, layout);
+      auto in2          = std::make_shared<SyntheticStore<RHS2, DIM>>(rect, layout);
+      auto out          = std::make_shared<SyntheticStore<LHS, DIM>>(rect, layout);
+      in1->fill_random(1);
+      in2->fill_random(2);
+      out->fill(LHS{});
+      Pitches<DIM - 1> pitches;
+      pitches.flatten(rect);
+      auto op_layout = layout == Layout::DENSE ? BinaryOpLayout::DENSE : BinaryOpLayout::STRIDED;
+      return std::function<void()>([=]() {
+        OP func{std::vector<Store>{}};
+        BinaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func,
+                                                     out->write_accessor(),
+                                                     in1->read_accessor(),
+                                                     in2->read_accessor(),
+                                                     pitches,
+                                                     rect,
+                                                     op_layout);
+      });
+    });
+}
+
+template <VariantKind KIND>
+void add_binary_ops(Suite& suite, const Config& config)
+{
+  add_binary_op<KIND, BinaryOpCode::ADD, Type::Code::INT32>(suite, config, "add");
+  add_binary_op<KIND, BinaryOpCode::ADD, Type::Code::FLOAT32>(suite, config, "add");
+  add_binary_op<KIND, BinaryOpCode::ADD, Type::Code::FLOAT64>(suite, config, "add");
+  add_binary_op<KIND, BinaryOpCode::GREATER, Type::Code::FLOAT64>(suite, config, "greater");
+}
+
+}  // namespace
+
+void register_binary_op_benchmarks(Suite& suite, const Config& config)
+{
+  add_binary_ops<VariantKind::CPU>(suite, config);
+#ifdef LEGATE_USE_OPENMP
+  add_binary_ops<VariantKind::OMP>(suite, config);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cunumeric
@@ -0,0 +1,192 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+#include "cunumeric/cunumeric.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#ifdef LEGATE_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace cunumeric {
+
+// The task bodies are compiled into this binary together with their variants, whose
+// registration callbacks record them here. The registrar is never used otherwise, as
+// the benchmarks don't start the runtime.
+/*static*/ legate::TaskRegistrar& CuNumericRegistrar::get_registrar()
+{
+  static legate::TaskRegistrar registrar;
+  return registrar;
+}
+
+namespace bench {
+
+namespace {
+
+void usage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [options]\n"
+            << "  --volume N       number of points per store (default: 4194304)\n"
+            << "  --repeat N       number of timed runs per case (default: 5)\n"
+            << "  --threads N,...  thread counts for the OpenMP variants\n"
+            << "                   (default: powers of two up to the number of cores)\n"
+            << "  --filter STR     only run cases whose family/op contains STR\n"
+            << "  --output FILE    write the JSON report to FILE instead of stdout\n";
+}
+
+std::vector<int32_t> parse_thread_counts(const std::string& arg)
+{
+  std::vector<int32_t> counts;
+  std::stringstream ss(arg);
+  std::string token;
+  while (std::getline(ss, token, ',')) counts.push_back(std::max(std::atoi(token.c_str()), 1));
+  return counts;
+}
+
+std::vector<int32_t> default_thread_counts()
+{
+  std::vector<int32_t> counts;
+#ifdef LEGATE_USE_OPENMP
+  int32_t max_threads = omp_get_max_threads();
+  for (int32_t count = 1; count < max_threads; count *= 2) counts.push_back(count);
+  counts.push_back(max_threads);
+#else
+  counts.push_back(1);
+#endif
+  return counts;
+}
+
+struct Result {
+  const Case* c;
+  int32_t threads;
+  double min_seconds;
+  double mean_seconds;
+};
+
+Result run_case(const Case& c, int32_t threads, int32_t repeat)
+{
+#ifdef LEGATE_USE_OPENMP
+  if (c.threaded) omp_set_num_threads(threads);
+#endif
+  auto run = c.prepare();
+  // Warm up the caches and fault in the pages of the outputs
+  run();
+
+  double min_seconds = std::numeric_limits<double>::max();
+  double sum_seconds = 0.0;
+  for (int32_t iter = 0; iter < repeat; ++iter) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto stop    = std::chrono::steady_clock::now();
+    auto seconds = std::chrono::duration<double>(stop - start).count();
+    min_seconds  = std::min(min_seconds, seconds);
+    sum_seconds += seconds;
+  }
+  return Result{&c, threads, min_seconds, sum_seconds / repeat};
+}
+
+void write_json(std::ostream& os, const std::vector<Result>& results)
+{
+  os << "[\n";
+  for (size_t idx = 0; idx < results.size(); ++idx) {
+    auto& r = results[idx];
+    auto& c = *r.c;
+    os << "  {\"family\": \"" << c.family << "\", \"op\": \"" << c.op << "\", \"variant\": \""
+       << c.variant << "\", \"dtype\": \"" << c.dtype << "\", \"layout\": \"" << c.layout
+       << "\", \"dim\": " << c.dim << ", \"threads\": " << r.threads
+       << ", \"volume\": " << c.volume << ", \"min_seconds\": " << r.min_seconds
+       << ", \"mean_seconds\": " << r.mean_seconds
+       << ", \"gb_per_second\": " << c.bytes / r.min_seconds * 1e-9 << "}"
+       << (idx + 1 < results.size() ? ",\n" : "\n");
+  }
+  os << "]\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  Config config;
+  config.thread_counts = default_thread_counts();
+  std::string output;
+
+  for (int32_t idx = 1; idx < argc; ++idx) {
+    std::string arg = argv[idx];
+    if (arg == "--help" || arg == "-h") {
+      usage(argv[0]);
+      return 0;
+    }
+    if (idx + 1 >= argc) {
+      usage(argv[0]);
+      return 1;
+    }
+    std::string value = argv[++idx];
+    if (arg == "--volume")
+      config.volume = std::strtoull(value.c_str(), nullptr, 10);
+    else if (arg == "--repeat")
+      config.repeat = std::max(std::atoi(value.c_str()), 1);
+    else if (arg == "--threads")
+      config.thread_counts = parse_thread_counts(value);
+    else if (arg == "--filter")
+      config.filter = value;
+    else if (arg == "--output")
+      output = value;
+    else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  Suite suite;
+  register_unary_op_benchmarks(suite, config);
+  register_binary_op_benchmarks(suite, config);
+  register_unary_red_benchmarks(suite, config);
+  register_scan_benchmarks(suite, config);
+  register_sort_benchmarks(suite, config);
+
+  std::vector<Result> results;
+  for (auto& c : suite.cases()) {
+    if (!config.filter.empty() &&
+        (c.family + "/" + c.op).find(config.filter) == std::string::npos)
+      continue;
+    if (c.threaded)
+      for (auto threads : config.thread_counts)
+        results.push_back(run_case(c, threads, config.repeat));
+    else
+      results.push_back(run_case(c, 1, config.repeat));
+  }
+
+  if (output.empty())
+    write_json(std::cout, results);
+  else {
+    std::ofstream os(output);
+    write_json(os, results);
+  }
+  return 0;
+}
+
+}  // namespace bench
+}  // namespace cunumeric
+
+int main(int argc, char** argv) { return cunumeric::bench::main(argc, argv); }
@@ -0,0 +1,88 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+
+#include "cunumeric/scan/scan_global.cc"
+#ifdef LEGATE_USE_OPENMP
+#include "cunumeric/scan/scan_global_omp.cc"
+#endif
+
+namespace cunumeric {
+namespace bench {
+
+namespace {
+
+// Number of partitions along the scan axis that precede the benchmarked one, whose
+// partial sums are folded into the prefix applied to each row
+constexpr coord_t NUM_PRECEDING_PARTITIONS = 4;
+
+template <VariantKind KIND, ScanCode OP_CODE, Type::Code CODE>
+void add_scan_global(Suite& suite, const Config& config, const char* op_name)
+{
+  using OP  = ScanOp<OP_CODE, CODE>;
+  using VAL = legate_type_of<CODE>;
+
+  add_sweep<KIND>(
+    suite,
+    config,
+    "scan_global",
+    op_name,
+    type_name<VAL>(),
+    2 * sizeof(VAL),
+    [](auto dim, auto rect, Layout layout) {
+      constexpr int DIM = decltype(dim)::value;
+
+      auto sum_vals_rect        = rect;
+      sum_vals_rect.lo[DIM - 1] = 0;
+      sum_vals_rect.hi[DIM - 1] = NUM_PRECEDING_PARTITIONS;
+
+      auto out      = std::make_shared<SyntheticStore<VAL, DIM>>(rect, layout);
+      auto sum_vals = std::make_shared<SyntheticStore<VAL, DIM>>(sum_vals_rect, layout);
+      out->fill_random(1);
+      sum_vals->fill_random(2);
+      Point<DIM> partition_index = Point<DIM>::ZEROES();
+      partition_index[DIM - 1]   = NUM_PRECEDING_PARTITIONS;
+      return std::function<void()>([=]() {
+        ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(OP{},
+                                                       out->read_write_accessor(),
+                                                       sum_vals->read_accessor(),
+                                                       rect,
+                                                       DIM - 1,
+                                                       DomainPoint(partition_index));
+      });
+    });
+}
+
+template <VariantKind KIND>
+void add_scans(Suite& suite, const Config& config)
+{
+  add_scan_global<KIND, ScanCode::SUM, Type::Code::INT64>(suite, config, "sum");
+  add_scan_global<KIND, ScanCode::SUM, Type::Code::FLOAT64>(suite, config, "sum");
+}
+
+}  // namespace
+
+void register_scan_benchmarks(Suite& suite, const Config& config)
+{
+  add_scans<VariantKind::CPU>(suite, config);
+#ifdef LEGATE_USE_OPENMP
+  add_scans<VariantKind::OMP>(suite, config);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cunumeric
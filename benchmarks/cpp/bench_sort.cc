@@ -0,0 +1,89 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+
+#include "cunumeric/sort/sort_cpu.inl"
+
+#include <cstring>
+
+namespace cunumeric {
+namespace bench {
+
+namespace {
+
+// Sorts each row of the store along the innermost axis with the local sort kernel that the
+// sort tasks run before exchanging samples between processors. Each run restores the
+// unsorted input first, which is included in the timing.
+template <VariantKind KIND, Type::Code CODE>
+void add_sort(Suite& suite, const Config& config, bool argsort)
+{
+  using VAL = legate_type_of<CODE>;
+
+  add_sweep<KIND, 1, true>(
+    suite,
+    config,
+    "sort",
+    argsort ? "argsort" : "sort",
+    type_name<VAL>(),
+    argsort ? 2 * (sizeof(VAL) + sizeof(int64_t)) : 2 * sizeof(VAL),
+    [argsort](auto dim, auto rect, Layout layout) {
+      constexpr int DIM = decltype(dim)::value;
+      auto input        = std::make_shared<SyntheticStore<VAL, DIM>>(rect, layout);
+      auto values       = std::make_shared<SyntheticStore<VAL, DIM>>(rect, layout);
+      auto indices      = std::make_shared<SyntheticStore<int64_t, DIM>>(rect, layout);
+      input->fill_random();
+
+      size_t volume        = rect.volume();
+      size_t sort_dim_size = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+      return std::function<void()>([=]() {
+        std::memcpy(values->data(), input->data(), input->bytes());
+        int64_t* argptr = nullptr;
+        if (argsort) {
+          argptr = indices->data();
+          for (size_t idx = 0; idx < volume; ++idx) argptr[idx] = idx % sort_dim_size;
+        }
+        if constexpr (KIND == VariantKind::OMP)
+          thrust_local_sort_inplace(
+            values->data(), argptr, volume, sort_dim_size, argsort, thrust::omp::par);
+        else
+          thrust_local_sort_inplace(
+            values->data(), argptr, volume, sort_dim_size, argsort, thrust::host);
+      });
+    });
+}
+
+template <VariantKind KIND>
+void add_sorts(Suite& suite, const Config& config)
+{
+  for (bool argsort : {false, true}) {
+    add_sort<KIND, Type::Code::INT32>(suite, config, argsort);
+    add_sort<KIND, Type::Code::FLOAT64>(suite, config, argsort);
+  }
+}
+
+}  // namespace
+
+void register_sort_benchmarks(Suite& suite, const Config& config)
+{
+  add_sorts<VariantKind::CPU>(suite, config);
+#ifdef LEGATE_USE_OPENMP
+  add_sorts<VariantKind::OMP>(suite, config);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cunumeric
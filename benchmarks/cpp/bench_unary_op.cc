@@ -0,0 +1,81 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+
+#include "cunumeric/unary/unary_op.cc"
+#ifdef LEGATE_USE_OPENMP
+#include "cunumeric/unary/unary_op_omp.cc"
+#endif
+
+namespace cunumeric {
+namespace bench {
+
+namespace {
+
+template <VariantKind KIND, UnaryOpCode OP_CODE, Type::Code CODE>
+void add_unary_op(Suite& suite, const Config& config, const char* op_name)
+{
+  using OP  = UnaryOp<OP_CODE, CODE>;
+  using ARG = typename OP::T;
+  using RES = std::result_of_t<OP(ARG)>;
+
+  add_sweep<KIND>(
+    suite,
+    config,
+    "unary_op",
+    op_name,
+    type_name<ARG>(),
+    sizeof(ARG) + sizeof(RES),
+    [](auto dim, auto rect, Layout layout) {
+      constexpr int DIM = decltype(dim)::value;
+      auto in           = std::make_shared<SyntheticStore<ARG, DIM>>(rect, layout);
+      auto out          = std::make_shared<SyntheticStore<RES, DIM>>(rect, layout);
+      in->fill_random();
+      out->fill(RES{});
+      Pitches<DIM - 1> pitches;
+      pitches.flatten(rect);
+      bool dense = layout == Layout::DENSE;
+      return std::function<void()>([=]() {
+        OP func{std::vector<Store>{}};
+        UnaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(
+          func, out->write_accessor(), in->read_accessor(), pitches, rect, dense);
+      });
+    });
+}
+
+template <VariantKind KIND>
+void add_unary_ops(Suite& suite, const Config& config)
+{
+  // A memory-bound and a compute-bound operation
+  add_unary_op<KIND, UnaryOpCode::NEGATIVE, Type::Code::INT64>(suite, config, "negative");
+  add_unary_op<KIND, UnaryOpCode::NEGATIVE, Type::Code::FLOAT64>(suite, config, "negative");
+  add_unary_op<KIND, UnaryOpCode::EXP, Type::Code::FLOAT32>(suite, config, "exp");
+  add_unary_op<KIND, UnaryOpCode::EXP, Type::Code::FLOAT64>(suite, config, "exp");
+}
+
+}  // namespace
+
+void register_unary_op_benchmarks(Suite& suite, const Config& config)
+{
+  add_unary_ops<VariantKind::CPU>(suite, config);
+#ifdef LEGATE_USE_OPENMP
+  add_unary_ops<VariantKind::OMP>(suite, config);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cunumeric
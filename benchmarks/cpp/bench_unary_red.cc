@@ -0,0 +1,93 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench.h"
+
+#include "cunumeric/unary/unary_red.cc"
+#ifdef LEGATE_USE_OPENMP
+#include "cunumeric/unary/unary_red_omp.cc"
+#endif
+
+namespace cunumeric {
+namespace bench {
+
+namespace {
+
+// Reduces along the innermost axis when `innermost` is true and along the outermost one
+// otherwise, which are the two extremes for the locality of the reduction
+template <VariantKind KIND, UnaryRedCode OP_CODE, Type::Code CODE>
+void add_unary_red(Suite& suite, const Config& config, const char* op_name, bool innermost)
+{
+  using OP    = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP = typename OP::OP;
+  using RHS   = legate_type_of<CODE>;
+  using VAL   = typename OP::VAL;
+
+  std::string op = std::string(op_name) + (innermost ? "_inner" : "_outer");
+  add_sweep<KIND, 2>(
+    suite,
+    config,
+    "unary_red",
+    op,
+    type_name<RHS>(),
+    sizeof(RHS),
+    [innermost](auto dim, auto rect, Layout layout) {
+      constexpr int DIM       = decltype(dim)::value;
+      int collapsed_dim       = innermost ? DIM - 1 : 0;
+      uint32_t collapsed_mask = 1U << collapsed_dim;
+
+      auto rhs = std::make_shared<SyntheticStore<RHS, DIM>>(rect, layout);
+      auto lhs = std::make_shared<SyntheticStore<VAL, DIM>>(rect, layout, collapsed_mask);
+      rhs->fill_random();
+      lhs->fill(LG_OP::identity);
+      Pitches<DIM - 1> pitches;
+      size_t volume = pitches.flatten(rect);
+      return std::function<void()>([=]() {
+        UnaryRedImplBody<KIND, OP_CODE, CODE, DIM, false>()(
+          lhs->template reduce_accessor<LG_OP, true>(),
+          rhs->read_accessor(),
+          AccessorRO<bool, DIM>{},
+          rect,
+          pitches,
+          collapsed_dim,
+          collapsed_mask,
+          volume);
+      });
+    });
+}
+
+template <VariantKind KIND>
+void add_unary_reds(Suite& suite, const Config& config)
+{
+  for (bool innermost : {true, false}) {
+    add_unary_red<KIND, UnaryRedCode::SUM, Type::Code::FLOAT32>(suite, config, "sum", innermost);
+    add_unary_red<KIND, UnaryRedCode::SUM, Type::Code::FLOAT64>(suite, config, "sum", innermost);
+    add_unary_red<KIND, UnaryRedCode::MAX, Type::Code::INT64>(suite, config, "max", innermost);
+  }
+}
+
+}  // namespace
+
+void register_unary_red_benchmarks(Suite& suite, const Config& config)
+{
+  add_unary_reds<VariantKind::CPU>(suite, config);
+#ifdef LEGATE_USE_OPENMP
+  add_unary_reds<VariantKind::OMP>(suite, config);
+#endif
+}
+
+}  // namespace bench
+}  // namespace cunumeric
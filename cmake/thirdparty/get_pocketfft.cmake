@@ -0,0 +1,56 @@
+#=============================================================================
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#=============================================================================
+
+function(find_or_configure_pocketfft)
+  set(oneValueArgs VERSION REPOSITORY BRANCH PINNED_COMMIT)
+  cmake_parse_arguments(PKG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  include(${CMAKE_CURRENT_SOURCE_DIR}/cmake/Modules/cpm_helpers.cmake)
+  if(PKG_BRANCH)
+    get_cpm_git_args(pocketfft_cpm_git_args REPOSITORY ${PKG_REPOSITORY} BRANCH ${PKG_BRANCH})
+  else()
+    # pocketfft has no releases, so builds are pinned to a commit of its cpp branch
+    set(pocketfft_cpm_git_args GIT_REPOSITORY ${PKG_REPOSITORY} GIT_TAG ${PKG_PINNED_COMMIT})
+  endif()
+
+  # pocketfft is header-only and has no build system of its own, so we only
+  # download it and point cuNumeric's host FFT sources at the header.
+  rapids_cpm_find(pocketfft ${PKG_VERSION}
+      CPM_ARGS
+        ${pocketfft_cpm_git_args}
+        DOWNLOAD_ONLY YES
+  )
+
+  set(cunumeric_POCKETFFT_INCLUDE_DIR "${pocketfft_SOURCE_DIR}" PARENT_SCOPE)
+endfunction()
+
+if(NOT DEFINED cunumeric_POCKETFFT_BRANCH)
+  set(cunumeric_POCKETFFT_BRANCH "")
+endif()
+
+if(NOT DEFINED cunumeric_POCKETFFT_COMMIT)
+  set(cunumeric_POCKETFFT_COMMIT bf2c431c21213b7c5e23c2f542009b0bd3ec1445)
+endif()
+
+if(NOT DEFINED cunumeric_POCKETFFT_REPOSITORY)
+  set(cunumeric_POCKETFFT_REPOSITORY https://github.com/mreineck/pocketfft.git)
+endif()
+
+find_or_configure_pocketfft(VERSION       0.0.0
+                            REPOSITORY    ${cunumeric_POCKETFFT_REPOSITORY}
+                            BRANCH        ${cunumeric_POCKETFFT_BRANCH}
+                            PINNED_COMMIT ${cunumeric_POCKETFFT_COMMIT}
+)
@@ -53,13 +53,7 @@ from .config import (
 from .coverage import FALLBACK_WARNING, clone_class, is_implemented
 from .runtime import runtime
 from .types import NdShape
-from .utils import (
-    calculate_volume,
-    deep_apply,
-    dot_modes,
-    to_core_dtype,
-    tuple_pop,
-)
+from .utils import deep_apply, dot_modes, to_core_dtype
 
 if TYPE_CHECKING:
     from pathlib import Path
@@ -2786,7 +2780,7 @@ class ndarray:
 
         Availability
         --------
-        Multiple GPUs
+        Multiple GPUs, Multiple CPUs
 
         """
         # Type
@@ -3114,7 +3108,9 @@ class ndarray:
                 else:
                     divisor -= ddof
             else:
-                divisor = self.shape[axis] - ddof
+                axes = normalize_axis_tuple(axis, self.ndim)
+                extents = (self.shape[ax] for ax in axes)
+                divisor = reduce(lambda x, y: x * y, extents, 1) - ddof
 
         # Divide by the number of things in the collapsed dimensions
         # Pick the right kinds of division based on the dtype
@@ -3152,12 +3148,6 @@ class ndarray:
         Multiple GPUs, Multiple CPUs
 
         """
-        if axis is not None and not isinstance(axis, int):
-            raise NotImplementedError(
-                "cunumeric.mean only supports int types for "
-                "`axis` currently"
-            )
-
         dtype = self._summation_dtype(dtype)
         where_array = broadcast_where(where, self.shape)
 
@@ -3242,32 +3232,17 @@ class ndarray:
         Multiple GPUs, Multiple CPUs
 
         """
-        if axis is not None and not isinstance(axis, int):
-            raise NotImplementedError(
-                "cunumeric.var only supports int types for `axis` currently"
-            )
-
-        # this could be computed as a single pass through the array
-        # by computing both <x^2> and <x> and then computing <x^2> - <x>^2.
-        # this would takee the difference of two large numbers and is unstable
-        # the mean needs to be computed first and the variance computed
-        # directly as <(x-mu)^2>, which then requires two passes through the
-        # data to first compute the mean and then compute the variance
-        # see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-        # TODO(https://github.com/nv-legate/cunumeric/issues/590)
-
         dtype = self._summation_dtype(dtype)
-        # calculate the mean, but keep the dimensions so that the
-        # mean can be broadcast against the original array
-        mu = self.mean(axis=axis, dtype=dtype, keepdims=True, where=where)
-
         where_array = broadcast_where(where, self.shape)
 
-        # 1D arrays (or equivalent) should benefit from this unary reduction:
-        if axis is None or calculate_volume(tuple_pop(self.shape, axis)) == 1:
-            # this is a scalar reduction and we can optimize this as a single
-            # pass through a scalar reduction
-            result = self._perform_unary_reduction(
+        # For single and double precision, we accumulate the count, the mean,
+        # and the sum of squared deviations (M2) of the values with Welford's
+        # algorithm, merging partial results with Chan et al.'s pairwise
+        # update. This is a single pass through the array and avoids the
+        # cancellation of computing <x^2> - <x>^2.
+        # see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+        if dtype in (np.dtype(np.float32), np.dtype(np.float64)):
+            return self._perform_unary_reduction(
                 UnaryRedCode.VARIANCE,
                 self,
                 axis=axis,
@@ -3275,29 +3250,26 @@ class ndarray:
                 out=out,
                 keepdims=keepdims,
                 where=where_array,
-                args=(mu,),
-            )
-        else:
-            # TODO(https://github.com/nv-legate/cunumeric/issues/591)
-            # there isn't really support for generic binary reductions
-            # right now all of the current binary reductions are boolean
-            # reductions like allclose. To implement this a single pass would
-            # require a variant of einsum/dot that produces
-            # (self-mu)*(self-mu) rather than self*mu. For now, we have to
-            # compute delta = self-mu in a first pass and then compute
-            # delta*delta in second pass
-            delta = self - mu
-
-            result = self._perform_unary_reduction(
-                UnaryRedCode.SUM_SQUARES,
-                delta,
-                axis=axis,
-                dtype=dtype,
-                out=out,
-                keepdims=keepdims,
-                where=where_array,
+                args=(np.array(ddof, dtype=np.int64),),
             )
 
+        # Otherwise, the mean needs to be computed first and the variance
+        # computed directly as <(x-mu)^2>, which requires two passes through
+        # the data. We keep the dimensions of the mean so that it can be
+        # broadcast against the original array
+        mu = self.mean(axis=axis, dtype=dtype, keepdims=True, where=where)
+        delta = self - mu
+
+        result = self._perform_unary_reduction(
+            UnaryRedCode.SUM_SQUARES,
+            delta,
+            axis=axis,
+            dtype=dtype,
+            out=out,
+            keepdims=keepdims,
+            where=where_array,
+        )
+
         self._normalize_summation(
             result,
             axis=axis,
@@ -144,6 +144,9 @@ class _CunumericSharedLib:
     CUNUMERIC_CONVERT_NAN_PROD: int
     CUNUMERIC_CONVERT_NAN_SUM: int
     CUNUMERIC_CONVOLVE: int
+    CUNUMERIC_CONVOLVE_FULL: int
+    CUNUMERIC_CONVOLVE_SAME: int
+    CUNUMERIC_CONVOLVE_VALID: int
     CUNUMERIC_DIAG: int
     CUNUMERIC_DOT: int
     CUNUMERIC_EYE: int
@@ -158,6 +161,9 @@ class _CunumericSharedLib:
     CUNUMERIC_FFT_Z2Z: int
     CUNUMERIC_FILL: int
     CUNUMERIC_FLIP: int
+    CUNUMERIC_FUSED_BINARY: int
+    CUNUMERIC_FUSED_ELEMENTWISE: int
+    CUNUMERIC_FUSED_UNARY: int
     CUNUMERIC_GEMM: int
     CUNUMERIC_HISTOGRAM: int
     CUNUMERIC_LOAD_CUDALIBS: int
@@ -168,6 +174,7 @@ class _CunumericSharedLib:
     CUNUMERIC_MAX_TASKS: int
     CUNUMERIC_NONZERO: int
     CUNUMERIC_PACKBITS: int
+    CUNUMERIC_PARTITION: int
     CUNUMERIC_POTRF: int
     CUNUMERIC_PUTMASK: int
     CUNUMERIC_RAND: int
@@ -194,6 +201,9 @@ class _CunumericSharedLib:
     CUNUMERIC_SCALAR_UNARY_RED: int
     CUNUMERIC_SCAN_GLOBAL: int
     CUNUMERIC_SCAN_LOCAL: int
+    CUNUMERIC_SCAN_LOCAL_FULL: int
+    CUNUMERIC_SCAN_LOCAL_PREFIXED: int
+    CUNUMERIC_SCAN_LOCAL_TOTALS: int
     CUNUMERIC_SCAN_PROD: int
     CUNUMERIC_SCAN_SUM: int
     CUNUMERIC_SEARCHSORTED: int
@@ -234,6 +244,7 @@ class _CunumericSharedLib:
     CUNUMERIC_UOP_FLOOR: int
     CUNUMERIC_UOP_FREXP: int
     CUNUMERIC_UOP_GETARG: int
+    CUNUMERIC_UOP_GETVAR: int
     CUNUMERIC_UOP_IMAG: int
     CUNUMERIC_UOP_INVERT: int
     CUNUMERIC_UOP_ISFINITE: int
@@ -281,6 +292,12 @@ class _CunumericSharedLib:
     ) -> None:
         ...
 
+    @abstractmethod
+    def cunumeric_register_welford_op(
+        self, type_uid: int, elem_type_code: int
+    ) -> None:
+        ...
+
 
 # Load the cuNumeric library first so we have a shard object that
 # we can use to initialize all these configuration enumerations
@@ -349,6 +366,7 @@ class CuNumericOpCode(IntEnum):
     FFT = _cunumeric.CUNUMERIC_FFT
     FILL = _cunumeric.CUNUMERIC_FILL
     FLIP = _cunumeric.CUNUMERIC_FLIP
+    FUSED_ELEMENTWISE = _cunumeric.CUNUMERIC_FUSED_ELEMENTWISE
     GEMM = _cunumeric.CUNUMERIC_GEMM
     HISTOGRAM = _cunumeric.CUNUMERIC_HISTOGRAM
     LOAD_CUDALIBS = _cunumeric.CUNUMERIC_LOAD_CUDALIBS
@@ -356,6 +374,7 @@ class CuNumericOpCode(IntEnum):
     MATVECMUL = _cunumeric.CUNUMERIC_MATVECMUL
     NONZERO = _cunumeric.CUNUMERIC_NONZERO
     PACKBITS = _cunumeric.CUNUMERIC_PACKBITS
+    PARTITION = _cunumeric.CUNUMERIC_PARTITION
     POTRF = _cunumeric.CUNUMERIC_POTRF
     PUTMASK = _cunumeric.CUNUMERIC_PUTMASK
     RAND = _cunumeric.CUNUMERIC_RAND
@@ -409,6 +428,7 @@ class UnaryOpCode(IntEnum):
     FLOOR = _cunumeric.CUNUMERIC_UOP_FLOOR
     FREXP = _cunumeric.CUNUMERIC_UOP_FREXP
     GETARG = _cunumeric.CUNUMERIC_UOP_GETARG
+    GETVAR = _cunumeric.CUNUMERIC_UOP_GETVAR
     IMAG = _cunumeric.CUNUMERIC_UOP_IMAG
     INVERT = _cunumeric.CUNUMERIC_UOP_INVERT
     ISFINITE = _cunumeric.CUNUMERIC_UOP_ISFINITE
@@ -532,6 +552,21 @@ class ScanCode(IntEnum):
     SUM = _cunumeric.CUNUMERIC_SCAN_SUM
 
 
+# Match these to CuNumericScanLocalMode in cunumeric_c.h
+@unique
+class ScanLocalMode(IntEnum):
+    FULL = _cunumeric.CUNUMERIC_SCAN_LOCAL_FULL
+    TOTALS = _cunumeric.CUNUMERIC_SCAN_LOCAL_TOTALS
+    PREFIXED = _cunumeric.CUNUMERIC_SCAN_LOCAL_PREFIXED
+
+
+# Match these to CuNumericFusedOpKind in cunumeric_c.h
+@unique
+class FusedOpKind(IntEnum):
+    UNARY = _cunumeric.CUNUMERIC_FUSED_UNARY
+    BINARY = _cunumeric.CUNUMERIC_FUSED_BINARY
+
+
 # Match these to CuNumericConvertCode in cunumeric_c.h
 @unique
 class ConvertCode(IntEnum):
@@ -759,6 +794,14 @@ class Bitorder(IntEnum):
     LITTLE = _cunumeric.CUNUMERIC_BITORDER_LITTLE
 
 
+# Match these to CuNumericConvolveMode in cunumeric_c.h
+@unique
+class ConvolveModeCode(IntEnum):
+    FULL = _cunumeric.CUNUMERIC_CONVOLVE_FULL
+    VALID = _cunumeric.CUNUMERIC_CONVOLVE_VALID
+    SAME = _cunumeric.CUNUMERIC_CONVOLVE_SAME
+
+
 @unique
 class FFTNormalization(IntEnum):
     FORWARD = 1
@@ -48,14 +48,18 @@ from .config import (
     BitGeneratorOperation,
     Bitorder,
     ConvertCode,
+    ConvolveModeCode,
     CuNumericOpCode,
+    FusedOpKind,
     RandGenCode,
+    ScanLocalMode,
     UnaryOpCode,
     UnaryRedCode,
 )
 from .linalg.cholesky import cholesky
 from .linalg.solve import solve
-from .sort import sort
+from .settings import settings
+from .sort import partition, sort
 from .thunk import NumPyThunk
 from .utils import is_advanced_indexing
 
@@ -212,7 +216,7 @@ def min_identity(
 _UNARY_RED_IDENTITIES: Dict[UnaryRedCode, Callable[[Any], Any]] = {
     UnaryRedCode.SUM: lambda _: 0,
     UnaryRedCode.SUM_SQUARES: lambda _: 0,
-    UnaryRedCode.VARIANCE: lambda _: 0,
+    UnaryRedCode.VARIANCE: lambda _: (0, 0, 0),
     UnaryRedCode.PROD: lambda _: 1,
     UnaryRedCode.MIN: min_identity,
     UnaryRedCode.MAX: max_identity,
@@ -237,6 +241,92 @@ _UNARY_RED_IDENTITIES: Dict[UnaryRedCode, Callable[[Any], Any]] = {
 }
 
 
+# Elementwise operations that can be deferred into fused expressions. Each of
+# them maps floating-point values to values of the same type and takes no
+# extra arguments. Match these to FusedOps in fused_elementwise_util.h
+_FUSABLE_UNARY_OPS = frozenset(
+    (
+        UnaryOpCode.ABSOLUTE,
+        UnaryOpCode.EXP,
+        UnaryOpCode.LOG,
+        UnaryOpCode.NEGATIVE,
+        UnaryOpCode.SQRT,
+        UnaryOpCode.SQUARE,
+    )
+)
+
+_FUSABLE_BINARY_OPS = frozenset(
+    (
+        BinaryOpCode.ADD,
+        BinaryOpCode.DIVIDE,
+        BinaryOpCode.MAXIMUM,
+        BinaryOpCode.MINIMUM,
+        BinaryOpCode.MULTIPLY,
+        BinaryOpCode.SUBTRACT,
+    )
+)
+
+_FUSABLE_DTYPES = (np.dtype(np.float32), np.dtype(np.float64))
+
+# Match these to FUSED_MAX_INPUTS and FUSED_MAX_INSTRUCTIONS in
+# fused_elementwise_util.h
+_FUSED_MAX_INPUTS = 8
+_FUSED_MAX_INSTRUCTIONS = 16
+
+
+class _FusedExpr:
+    """An elementwise expression whose evaluation is deferred. The operands
+    are either other expressions or the thunks that the expression reads,
+    which are broadcast to the shape of the array the expression is stored
+    to when it is launched.
+
+    :meta private:
+    """
+
+    def __init__(
+        self,
+        kind: FusedOpKind,
+        op: Union[UnaryOpCode, BinaryOpCode],
+        operands: tuple[Union[_FusedExpr, DeferredArray], ...],
+    ) -> None:
+        self.kind = kind
+        self.op = op
+        self.operands = operands
+        # The thunks read by the expression, keyed by their identity
+        self.leaves: dict[int, DeferredArray] = {}
+        # An upper bound, as subexpressions used more than once are counted
+        # once per use
+        self.num_instructions = 1
+        for operand in operands:
+            if isinstance(operand, _FusedExpr):
+                self.leaves.update(operand.leaves)
+                self.num_instructions += operand.num_instructions
+            else:
+                self.leaves[id(operand)] = operand
+
+    def compile(self) -> tuple[list[DeferredArray], list[int]]:
+        """Returns the inputs of the expression and its program, as a flat
+        list of (kind, op code, src1, src2) tuples over registers that hold
+        the inputs followed by the results of the instructions."""
+        leaves = list(self.leaves.values())
+        registers = {id(leaf): idx for idx, leaf in enumerate(leaves)}
+        program: list[int] = []
+
+        def emit(expr: Union[_FusedExpr, DeferredArray]) -> int:
+            if id(expr) in registers:
+                return registers[id(expr)]
+            assert isinstance(expr, _FusedExpr)
+            srcs = [emit(operand) for operand in expr.operands]
+            if len(srcs) == 1:
+                srcs.append(0)
+            program.extend((expr.kind.value, expr.op.value, *srcs))
+            registers[id(expr)] = len(registers)
+            return registers[id(expr)]
+
+        emit(self)
+        return leaves, program
+
+
 @unique
 class BlasOperation(IntEnum):
     VV = 1
@@ -257,14 +347,37 @@ class DeferredArray(NumPyThunk):
         runtime: Runtime,
         base: Store,
         numpy_array: Optional[npt.NDArray[Any]] = None,
+        exposed: bool = True,
     ) -> None:
         super().__init__(runtime, base.type.to_numpy_dtype())
         assert base is not None
         assert isinstance(base, Store)
-        self.base: Any = base  # a Legate Store
+        self._base: Any = base  # a Legate Store
         self.numpy_array = (
             None if numpy_array is None else weakref.ref(numpy_array)
         )
+        # Whether anyone else may hold the store. Fused expressions are only
+        # deferred into stores that nobody else holds, so that nothing can
+        # read them before the expressions are launched.
+        self._exposed = exposed
+        # The pending fused expression that computes this array, if any
+        self._fused: Optional[_FusedExpr] = None
+
+    @property
+    def base(self) -> Any:
+        # Whoever uses the store must see the results of all the fused
+        # expressions deferred so far
+        if self.runtime.pending_fusions:
+            self.runtime.flush_fused_elementwise()
+        self._exposed = True
+        return self._base
+
+    @base.setter
+    def base(self, base: Any) -> None:
+        if self.runtime.pending_fusions:
+            self.runtime.flush_fused_elementwise()
+        self._exposed = True
+        self._base = base
 
     def __str__(self) -> str:
         return f"DeferredArray(base: {self.base})"
@@ -279,7 +392,7 @@ class DeferredArray(NumPyThunk):
 
     @property
     def shape(self) -> NdShape:
-        return tuple(self.base.shape)
+        return tuple(self._base.shape)
 
     @property
     def ndim(self) -> int:
@@ -912,7 +1025,10 @@ class DeferredArray(NumPyThunk):
         )
 
     def _broadcast(self, shape: NdShape) -> Any:
-        result = self.base
+        return self._broadcast_store(self.base, shape)
+
+    @staticmethod
+    def _broadcast_store(result: Any, shape: NdShape) -> Any:
         diff = len(shape) - result.ndim
         for dim in range(diff):
             result = result.promote(dim, shape[dim])
@@ -1379,31 +1495,59 @@ class DeferredArray(NumPyThunk):
 
         task = self.context.create_auto_task(CuNumericOpCode.CONVOLVE)
 
-        offsets = (filter.shape + 1) // 2
-        stencils: list[tuple[int, ...]] = []
-        for offset in offsets:
-            stencils.append((-offset, 0, offset))
-        stencils = list(product(*stencils))
-        stencils.remove((0,) * self.ndim)
-
         p_out = task.declare_partition(out)
-        p_input = task.declare_partition(input)
-        p_stencils = []
-        for _ in stencils:
-            p_stencils.append(task.declare_partition(input, complete=False))
-
         task.add_output(out, partition=p_out)
         task.add_input(filter)
-        task.add_input(input, partition=p_input)
-        for p_stencil in p_stencils:
-            task.add_input(input, partition=p_stencil)
-        task.add_scalar_arg(self.shape, (ty.int64,))
-
-        task.add_constraint(p_out == p_input)
-        for stencil, p_stencil in zip(stencils, p_stencils):
-            task.add_constraint(p_input + stencil <= p_stencil)  # type: ignore
         task.add_broadcast(filter)
 
+        if mode == "same":
+            offsets = (filter.shape + 1) // 2
+            stencils: list[tuple[int, ...]] = []
+            for offset in offsets:
+                stencils.append((-offset, 0, offset))
+            stencils = list(product(*stencils))
+            stencils.remove((0,) * self.ndim)
+
+            p_input = task.declare_partition(input)
+            p_stencils = []
+            for _ in stencils:
+                p_stencils.append(
+                    task.declare_partition(input, complete=False)
+                )
+
+            task.add_input(input, partition=p_input)
+            for p_stencil in p_stencils:
+                task.add_input(input, partition=p_stencil)
+
+            task.add_constraint(p_out == p_input)
+            for stencil, p_stencil in zip(stencils, p_stencils):
+                task.add_constraint(
+                    p_input + stencil <= p_stencil  # type: ignore
+                )
+        else:
+            # The output is larger ('full') or smaller ('valid') than the
+            # input, so the images of the input are derived from the output
+            # tiles instead. Output point p reads the input points from
+            # p - e + 1 to p in 'full' mode and from p to p + e - 1 in
+            # 'valid' mode, where e is the extent of the filter.
+            stencils = []
+            for extent in filter.shape:
+                if mode == "full":
+                    stencils.append((0, 1 - extent))
+                else:
+                    stencils.append((0, extent - 1))
+            stencils = list(OrderedSet(product(*stencils)))
+
+            for stencil in stencils:
+                p_stencil = task.declare_partition(input, complete=False)
+                task.add_input(input, partition=p_stencil)
+                task.add_constraint(
+                    p_out + stencil <= p_stencil  # type: ignore
+                )
+
+        task.add_scalar_arg(self.shape, (ty.int64,))
+        task.add_scalar_arg(ConvolveModeCode[mode.upper()].value, ty.int32)
+
         task.execute()
 
     @auto_convert("rhs")
@@ -1414,41 +1558,33 @@ class DeferredArray(NumPyThunk):
         kind: FFTType,
         direction: FFTDirection,
     ) -> None:
-        lhs = self
-        # For now, deferred only supported with GPU, use eager / numpy for CPU
-        if self.runtime.num_gpus == 0:
-            lhs_eager = lhs.runtime.to_eager_array(lhs)
-            rhs_eager = rhs.runtime.to_eager_array(rhs)
-            lhs_eager.fft(rhs_eager, axes, kind, direction)
-            lhs.base = lhs.runtime.to_deferred_array(lhs_eager).base
-        else:
-            input = rhs.base
-            output = lhs.base
+        input = rhs.base
+        output = self.base
 
-            task = self.context.create_auto_task(CuNumericOpCode.FFT)
-            p_output = task.declare_partition(output)
-            p_input = task.declare_partition(input)
+        task = self.context.create_auto_task(CuNumericOpCode.FFT)
+        p_output = task.declare_partition(output)
+        p_input = task.declare_partition(input)
 
-            task.add_output(output, partition=p_output)
-            task.add_input(input, partition=p_input)
-            task.add_scalar_arg(kind.type_id, ty.int32)
-            task.add_scalar_arg(direction.value, ty.int32)
-            task.add_scalar_arg(
-                len(OrderedSet(axes)) != len(axes)
-                or len(axes) != input.ndim
-                or tuple(axes) != tuple(sorted(axes)),
-                ty.bool_,
-            )
-            for ax in axes:
-                task.add_scalar_arg(ax, ty.int64)
+        task.add_output(output, partition=p_output)
+        task.add_input(input, partition=p_input)
+        task.add_scalar_arg(kind.type_id, ty.int32)
+        task.add_scalar_arg(direction.value, ty.int32)
+        task.add_scalar_arg(
+            len(OrderedSet(axes)) != len(axes)
+            or len(axes) != input.ndim
+            or tuple(axes) != tuple(sorted(axes)),
+            ty.bool_,
+        )
+        for ax in axes:
+            task.add_scalar_arg(ax, ty.int64)
 
-            if input.ndim > len(OrderedSet(axes)):
-                task.add_broadcast(input, axes=OrderedSet(axes))
-            else:
-                task.add_broadcast(input)
-            task.add_constraint(p_output == p_input)
+        if input.ndim > len(OrderedSet(axes)):
+            task.add_broadcast(input, axes=OrderedSet(axes))
+        else:
+            task.add_broadcast(input)
+        task.add_constraint(p_output == p_input)
 
-            task.execute()
+        task.execute()
 
     # Fill the cuNumeric array with the value in the numpy array
     def _fill(self, value: Any) -> None:
@@ -3110,6 +3246,14 @@ class DeferredArray(NumPyThunk):
         args: Any,
         multiout: Optional[Any] = None,
     ) -> None:
+        if (
+            multiout is None
+            and not args
+            and op in _FUSABLE_UNARY_OPS
+            and self._defer_fused(FusedOpKind.UNARY, op, (src,))
+        ):
+            return
+
         lhs = self.base
         rhs = src._broadcast(lhs.shape)
 
@@ -3162,6 +3306,19 @@ class DeferredArray(NumPyThunk):
                 inputs=[self],
             )
 
+        # Variance is accumulated as (count, mean, M2) in a single pass and
+        # the extra argument holds the delta degrees of freedom, which only
+        # the final extraction needs
+        welford = op == UnaryRedCode.VARIANCE
+        if welford:
+            welford_dtype = self.runtime.get_welford_type(rhs_array.base.type)
+            lhs_array = self.runtime.create_empty_thunk(
+                lhs_array.shape,
+                dtype=welford_dtype,
+                inputs=[self],
+            )
+            ddof_args, args = args, None
+
         is_where = bool(where is not None)
         # See if we are doing reduction to a point or another region
         if lhs_array.size == 1:
@@ -3212,26 +3369,24 @@ class DeferredArray(NumPyThunk):
 
             # If output dims is not 0, then we must have axes
             assert axes is not None
-            # Reduction to a smaller array
+            # All the collapsed dimensions are reduced by a single task, so
+            # we promote the result back to the shape of the source, which
+            # requires the axes in ascending order
+            axes = tuple(sorted(axes))
+            assert not argred or len(axes) == 1
             result = lhs_array.base  # type: ignore
             if keepdims:
-                for axis in axes:
+                for axis in reversed(axes):
                     result = result.project(axis, 0)
             for axis in axes:
                 result = result.promote(axis, rhs_array.shape[axis])
-            # Iterate over all the dimension(s) being collapsed and build a
-            # temporary field that we will reduce down to the final value
-            if len(axes) > 1:
-                raise NotImplementedError(
-                    "Need support for reducing multiple dimensions"
-                )
 
             with Annotation({"OpCode": op.name, "ArgRed?": str(argred)}):
                 task = self.context.create_auto_task(CuNumericOpCode.UNARY_RED)
 
                 task.add_input(rhs_array.base)
                 task.add_reduction(result, _UNARY_RED_TO_REDUCTION_OPS[op])
-                task.add_scalar_arg(axis, ty.int32)
+                task.add_scalar_arg(axes, (ty.int32,))
                 task.add_scalar_arg(op, ty.int32)
                 task.add_scalar_arg(is_where, ty.bool_)
                 if is_where:
@@ -3251,14 +3406,21 @@ class DeferredArray(NumPyThunk):
                 True,
                 [],
             )
+        elif welford:
+            self.unary_op(
+                UnaryOpCode.GETVAR,
+                lhs_array,
+                True,
+                ddof_args,
+            )
 
     def isclose(
         self, rhs1: Any, rhs2: Any, rtol: float, atol: float, equal_nan: bool
     ) -> None:
-        assert not equal_nan
         args = (
             np.array(rtol, dtype=np.float64),
             np.array(atol, dtype=np.float64),
+            np.array(equal_nan, dtype=bool),
         )
         self.binary_op(BinaryOpCode.ISCLOSE, rhs1, rhs2, True, args)
 
@@ -3272,6 +3434,13 @@ class DeferredArray(NumPyThunk):
         where: Any,
         args: Any,
     ) -> None:
+        if (
+            not args
+            and op_code in _FUSABLE_BINARY_OPS
+            and self._defer_fused(FusedOpKind.BINARY, op_code, (src1, src2))
+        ):
+            return
+
         lhs = self.base
         rhs1 = src1._broadcast(lhs.shape)
         rhs2 = src2._broadcast(lhs.shape)
@@ -3290,6 +3459,66 @@ class DeferredArray(NumPyThunk):
 
             task.execute()
 
+    # Tries to defer an elementwise operation into a fused expression that is
+    # launched once the array is used, and returns whether it did. Operands
+    # with pending expressions of their own are folded into the expression,
+    # so a chain of operations whose temporaries are dropped in the meantime
+    # runs as a single task that never writes the temporaries.
+    def _defer_fused(
+        self,
+        kind: FusedOpKind,
+        op: Union[UnaryOpCode, BinaryOpCode],
+        srcs: tuple[DeferredArray, ...],
+    ) -> bool:
+        if not settings.fuse_elementwise():
+            return False
+        if self._exposed or self._fused is not None:
+            return False
+        if self.dtype not in _FUSABLE_DTYPES:
+            return False
+        if any(src is self or src.dtype != self.dtype for src in srcs):
+            return False
+
+        operands: list[Union[_FusedExpr, DeferredArray]] = []
+        for src in srcs:
+            if src._fused is not None:
+                operands.append(src._fused)
+            else:
+                # The store is read when the expression is launched
+                src._exposed = True
+                operands.append(src)
+        expr = _FusedExpr(kind, op, tuple(operands))
+        if (
+            len(expr.leaves) > _FUSED_MAX_INPUTS
+            or expr.num_instructions > _FUSED_MAX_INSTRUCTIONS
+        ):
+            return False
+
+        self._fused = expr
+        self.runtime.pending_fusions.append(weakref.ref(self))
+        return True
+
+    def _launch_fused(self) -> None:
+        assert self._fused is not None
+        leaves, program = self._fused.compile()
+        self._fused = None
+
+        # Only the underlying stores are touched here, as accessing the base
+        # of any thunk would flush the pending expressions again
+        lhs = self._base
+        with Annotation({"OpCode": "FUSED_ELEMENTWISE"}):
+            task = self.context.create_auto_task(
+                CuNumericOpCode.FUSED_ELEMENTWISE
+            )
+            task.add_output(lhs)
+            for leaf in leaves:
+                rhs = self._broadcast_store(leaf._base, lhs.shape)
+                task.add_input(rhs)
+                task.add_alignment(lhs, rhs)
+            task.add_scalar_arg(tuple(program), (ty.int32,))
+
+            task.execute()
+
     @auto_convert("src1", "src2")
     def binary_reduction(
         self,
@@ -3408,11 +3637,15 @@ class DeferredArray(NumPyThunk):
             dtype=self.base.type, ndim=self.ndim
         )
 
-        if axis == rhs.ndim - 1:
+        # The host variants scan along any axis in place, whereas the GPU
+        # variants need the scan axis to be the last
+        if axis == rhs.ndim - 1 or self.runtime.num_gpus == 0:
             input = rhs
             output = self
+            scan_axis = axis
         else:
             # swap axes, always performing scan along last axis
+            scan_axis = rhs.ndim - 1
             swapped = rhs.swapaxes(axis, rhs.ndim - 1)
             input = self.runtime.create_empty_thunk(
                 swapped.shape, dtype=rhs.base.type, inputs=(rhs, swapped)
@@ -3420,29 +3653,63 @@ class DeferredArray(NumPyThunk):
             input.copy(swapped, deep=True)
             output = input
 
-        task = output.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
-        task.add_output(output.base)
-        task.add_input(input.base)
-        task.add_output(temp.base)
-        task.add_scalar_arg(op, ty.int32)
-        task.add_scalar_arg(nan_to_identity, ty.bool_)
+        if self.runtime.num_gpus == 0 and self.runtime.num_procs > 1:
+            # On the host, the first pass only computes the totals of the
+            # rows, and the second scans each row starting from the totals
+            # of the partitions before it. The output is then written once,
+            # instead of being written by the local scan and then read and
+            # written again to add the prefixes.
+            task = output.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
+            task.add_input(input.base)
+            task.add_output(temp.base)
+            task.add_scalar_arg(op, ty.int32)
+            task.add_scalar_arg(nan_to_identity, ty.bool_)
+            task.add_scalar_arg(ScanLocalMode.TOTALS, ty.int32)
+            task.add_scalar_arg(scan_axis, ty.int32)
 
-        task.add_alignment(input.base, output.base)
+            task.execute()
+            # NOTE: Assumes the partitioning stays the same from previous task.
+            task = output.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
+            task.add_output(output.base)
+            task.add_input(input.base)
+            task.add_input(temp.base)
+            task.add_scalar_arg(op, ty.int32)
+            task.add_scalar_arg(nan_to_identity, ty.bool_)
+            task.add_scalar_arg(ScanLocalMode.PREFIXED, ty.int32)
+            task.add_scalar_arg(scan_axis, ty.int32)
+
+            task.add_alignment(input.base, output.base)
+            task.add_broadcast(temp.base)
 
-        task.execute()
-        # Global sum
-        # NOTE: Assumes the partitioning stays the same from previous task.
-        # NOTE: Each node will do a sum up to its index, alternatively could
-        # do one centralized scan and broadcast (slightly less redundant work)
-        task = output.context.create_auto_task(CuNumericOpCode.SCAN_GLOBAL)
-        task.add_input(output.base)
-        task.add_input(temp.base)
-        task.add_output(output.base)
-        task.add_scalar_arg(op, ty.int32)
-
-        task.add_broadcast(temp.base)
+            task.execute()
+        else:
+            task = output.context.create_auto_task(CuNumericOpCode.SCAN_LOCAL)
+            task.add_output(output.base)
+            task.add_input(input.base)
+            task.add_output(temp.base)
+            task.add_scalar_arg(op, ty.int32)
+            task.add_scalar_arg(nan_to_identity, ty.bool_)
+            task.add_scalar_arg(ScanLocalMode.FULL, ty.int32)
+            task.add_scalar_arg(scan_axis, ty.int32)
 
-        task.execute()
+            task.add_alignment(input.base, output.base)
+
+            task.execute()
+            # Global sum
+            # NOTE: Assumes the partitioning stays the same from previous task.
+            # NOTE: Each node will do a sum up to its index, alternatively
+            # could do one centralized scan and broadcast (slightly less
+            # redundant work)
+            task = output.context.create_auto_task(CuNumericOpCode.SCAN_GLOBAL)
+            task.add_input(output.base)
+            task.add_input(temp.base)
+            task.add_output(output.base)
+            task.add_scalar_arg(op, ty.int32)
+            task.add_scalar_arg(scan_axis, ty.int32)
+
+            task.add_broadcast(temp.base)
+
+            task.execute()
 
         # if axes were swapped, turn them back
         if output is not self:
@@ -3537,8 +3804,17 @@ class DeferredArray(NumPyThunk):
         if axis is not None and (axis >= rhs.ndim or axis < -rhs.ndim):
             raise ValueError("invalid axis")
 
-        # fallback to sort for now
-        sort(self, rhs, argpartition, axis, False)
+        size = rhs.size if axis is None else rhs.shape[axis]
+        kth_array = np.asarray(kth)
+        if not np.issubdtype(kth_array.dtype, np.integer):
+            raise TypeError("Partition index must be integer")
+        kths: set[int] = set()
+        for k in kth_array.flat:
+            if k < -size or k >= size:
+                raise ValueError(f"kth(={k}) out of bounds ({size})")
+            kths.add(int(k) % size)
+
+        partition(self, rhs, tuple(sorted(kths)), argpartition, axis)
 
     def create_window(self, op_code: WindowOpCode, M: int, *args: Any) -> None:
         task = self.context.create_auto_task(CuNumericOpCode.WINDOW)
@@ -3617,7 +3893,9 @@ class DeferredArray(NumPyThunk):
 
     # Perform a histogram operation on the array
     @auto_convert("src", "bins", "weights")
-    def histogram(self, src: Any, bins: Any, weights: Any) -> None:
+    def histogram(
+        self, src: Any, bins: Any, weights: Any, uniform: bool = False
+    ) -> None:
         weight_array = weights
         src_array = src
         bins_array = bins
@@ -3637,6 +3915,9 @@ class DeferredArray(NumPyThunk):
         task.add_input(src_array.base)
         task.add_input(bins_array.base)
         task.add_input(weight_array.base)
+        # Equally spaced bins let the host variants compute the bin of each
+        # value directly instead of sorting the values
+        task.add_scalar_arg(uniform, ty.bool_)
 
         task.add_broadcast(bins_array.base)
         task.add_broadcast(dst_array.base)
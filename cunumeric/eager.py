@@ -1538,12 +1538,11 @@ class EagerArray(NumPyThunk):
                 keepdims=keepdims,
             )
         elif op == UnaryRedCode.VARIANCE:
-            (mu,) = args
-            centered = np.subtract(rhs.array, mu)
-            squares = np.square(centered)
-            np.sum(
-                squares,
+            (ddof,) = args
+            np.var(
+                rhs.array,
                 axis=orig_axis,
+                ddof=int(ddof),
                 where=where
                 if not isinstance(where, EagerArray)
                 else where.array,
@@ -1606,7 +1605,11 @@ class EagerArray(NumPyThunk):
             if op == BinaryOpCode.ISCLOSE:
                 self.array = np.array(
                     np.allclose(
-                        rhs1.array, rhs2.array, rtol=args[0], atol=args[1]
+                        rhs1.array,
+                        rhs2.array,
+                        rtol=args[0],
+                        atol=args[1],
+                        equal_nan=bool(args[2]),
                     )
                 )
             elif op == BinaryOpCode.EQUAL:
@@ -1743,10 +1746,12 @@ class EagerArray(NumPyThunk):
                     src_flat = np.tile(src_flat, reps)
                 self.array[:] = src_flat[:new_len]
 
-    def histogram(self, rhs: Any, bins: Any, weights: Any) -> None:
+    def histogram(
+        self, rhs: Any, bins: Any, weights: Any, uniform: bool = False
+    ) -> None:
         self.check_eager_args(rhs, bins, weights)
         if self.deferred is not None:
-            self.deferred.histogram(rhs, bins, weights)
+            self.deferred.histogram(rhs, bins, weights, uniform)
         else:
             self.array[:], _ = np.histogram(
                 rhs.array,
@@ -104,7 +104,7 @@ def fft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     axes = (axis,) if axis is not None else None
@@ -164,7 +164,7 @@ def fft2(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     return fftn(a=a, s=s, axes=axes, norm=norm)
 
@@ -222,7 +222,7 @@ def fftn(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     if a.dtype == np.float32:
         a = a.astype(np.complex64)
@@ -309,7 +309,7 @@ def ifft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     computed_axis = (axis,) if axis is not None else None
@@ -376,7 +376,7 @@ def ifft2(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     return ifftn(a=a, s=s, axes=axes, norm=norm)
 
@@ -443,7 +443,7 @@ def ifftn(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     # Convert to complex if real
     if a.dtype == np.float32:
@@ -518,7 +518,7 @@ def rfft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     computed_axis = (axis,) if axis is not None else None
@@ -565,7 +565,7 @@ def rfft2(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     return rfftn(a=a, s=s, axes=axes, norm=norm)
 
@@ -627,7 +627,7 @@ def rfftn(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     # Convert to real if complex
     if a.dtype != np.float32 and a.dtype != np.float64:
@@ -728,7 +728,7 @@ def irfft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     computed_axis = (axis,) if axis is not None else None
@@ -777,7 +777,7 @@ def irfft2(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     return irfftn(a=a, s=s, axes=axes, norm=norm)
 
@@ -850,7 +850,7 @@ def irfftn(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     # Convert to complex if real
     if a.dtype == np.float32:
@@ -942,7 +942,7 @@ def hfft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     computed_axis = (axis,) if axis is not None else None
@@ -1002,7 +1002,7 @@ def ihfft(
 
     Availability
     --------
-    Multiple GPUs
+    Multiple GPUs, Multiple CPUs
     """
     s = (n,) if n is not None else None
     computed_axis = (axis,) if axis is not None else None
@@ -5118,11 +5118,11 @@ def allclose(
     --------
     Multiple GPUs, Multiple CPUs
     """
-    if equal_nan:
-        raise NotImplementedError(
-            "cuNumeric does not support `equal_nan` yet for allclose"
-        )
-    args = (np.array(rtol, dtype=np.float64), np.array(atol, dtype=np.float64))
+    args = (
+        np.array(rtol, dtype=np.float64),
+        np.array(atol, dtype=np.float64),
+        np.array(equal_nan, dtype=bool),
+    )
     return ndarray._perform_binary_reduction(
         BinaryOpCode.ISCLOSE,
         a,
@@ -5179,11 +5179,6 @@ def isclose(
     --------
     Multiple GPUs, Multiple CPUs
     """
-    if equal_nan:
-        raise NotImplementedError(
-            "cuNumeric does not support `equal_nan` yet for isclose"
-        )
-
     out_shape = np.broadcast_shapes(a.shape, b.shape)
     out = empty(out_shape, dtype=bool)
 
@@ -5225,13 +5220,23 @@ def array_equal(
     --------
     Multiple GPUs, Multiple CPUs
     """
-    if equal_nan:
-        raise NotImplementedError(
-            "cuNumeric does not support `equal_nan` yet for `array_equal`"
-        )
-
     if a1.shape != a2.shape:
         return False
+    if equal_nan and ndarray.find_common_type(a1, a2).kind in ("f", "c"):
+        # An isclose with zero tolerances is an exact comparison, which
+        # lets the NaNs be matched inside the same reduction
+        args = (
+            np.array(0.0, dtype=np.float64),
+            np.array(0.0, dtype=np.float64),
+            np.array(True, dtype=bool),
+        )
+        return ndarray._perform_binary_reduction(
+            BinaryOpCode.ISCLOSE,
+            a1,
+            a2,
+            dtype=np.dtype(np.bool_),
+            extra_args=args,
+        )
     return ndarray._perform_binary_reduction(
         BinaryOpCode.EQUAL, a1, a2, dtype=np.dtype(np.bool_)
     )
@@ -6397,7 +6402,8 @@ def convolve(a: ndarray, v: ndarray, mode: ConvolveMode = "full") -> ndarray:
     Returns the discrete, linear convolution of two ndarrays.
 
     If `a` and `v` are both 1-D and `v` is longer than `a`, the two are
-    swapped before computation. For N-D cases, the arguments are never swapped.
+    swapped before computation. For N-D cases, the arguments are only swapped
+    in 'valid' mode when `v` is at least as large as `a` in every dimension.
 
     Parameters
     ----------
@@ -6408,10 +6414,11 @@ def convolve(a: ndarray, v: ndarray, mode: ConvolveMode = "full") -> ndarray:
     mode : ``{'full', 'valid', 'same'}``, optional
         'same':
           The output is the same size as `a`, centered with respect to
-          the 'full' output. (default)
+          the 'full' output.
 
         'full':
           The output is the full discrete linear convolution of the inputs.
+          (default)
 
         'valid':
           The output consists only of those elements that do not
@@ -6429,8 +6436,6 @@ def convolve(a: ndarray, v: ndarray, mode: ConvolveMode = "full") -> ndarray:
 
     Notes
     -----
-    The current implementation only supports the 'same' mode.
-
     Unlike `numpy.convolve`, `cunumeric.convolve` supports N-dimensional
     inputs, but it follows NumPy's behavior for 1-D inputs.
 
@@ -6438,8 +6443,10 @@ def convolve(a: ndarray, v: ndarray, mode: ConvolveMode = "full") -> ndarray:
     --------
     Multiple GPUs, Multiple CPUs
     """
-    if mode != "same":
-        raise NotImplementedError("Need to implement other convolution modes")
+    if mode not in ("full", "valid", "same"):
+        raise ValueError(
+            "Acceptable mode flags are 'valid', 'same', or 'full'"
+        )
 
     if a.ndim != v.ndim:
         raise RuntimeError("Arrays should have the same dimensions")
@@ -6448,11 +6455,25 @@ def convolve(a: ndarray, v: ndarray, mode: ConvolveMode = "full") -> ndarray:
 
     if a.ndim == 1 and a.size < v.size:
         v, a = a, v
+    elif mode == "valid" and any(sa < sv for sa, sv in zip(a.shape, v.shape)):
+        if any(sa > sv for sa, sv in zip(a.shape, v.shape)):
+            raise ValueError(
+                "For 'valid' mode, one must be at least as large as "
+                "the other in every dimension"
+            )
+        v, a = a, v
+
+    if mode == "full":
+        shape = tuple(sa + sv - 1 for sa, sv in zip(a.shape, v.shape))
+    elif mode == "valid":
+        shape = tuple(sa - sv + 1 for sa, sv in zip(a.shape, v.shape))
+    else:
+        shape = a.shape
 
     if a.dtype != v.dtype:
         v = v.astype(a.dtype)
     out = ndarray(
-        shape=a.shape,
+        shape=shape,
         dtype=a.dtype,
         inputs=(a, v),
     )
@@ -6527,7 +6548,7 @@ def unique(
     return_inverse: bool = False,
     return_counts: bool = False,
     axis: Optional[int] = None,
-) -> ndarray:
+) -> Union[ndarray, tuple[ndarray, ...]]:
     """
 
     Find the unique elements of an array.
@@ -6550,11 +6571,9 @@ def unique(
     return_inverse : bool, optional
         If True, also return the indices of the unique array (for the specified
         axis, if provided) that can be used to reconstruct `ar`.
-        Currently not supported.
     return_counts : bool, optional
         If True, also return the number of times each unique item appears
         in `ar`.
-        Currently not supported.
     axis : int or None, optional
         The axis to operate on. If None, `ar` will be flattened. If an integer,
         the subarrays indexed by the given axis will be flattened and treated
@@ -6588,16 +6607,28 @@ def unique(
 
     Notes
     --------
-    Keyword arguments for optional outputs are not yet supported.
-    `axis` is also not handled currently.
+    `return_index` is not yet supported. `axis` is also not handled
+    currently.
 
     """
-    if _builtin_any((return_index, return_inverse, return_counts, axis)):
+    if return_index or axis is not None:
         raise NotImplementedError(
-            "Keyword arguments for `unique` are not yet supported"
+            "`return_index` and `axis` are not yet supported for `unique`"
         )
 
-    return ar.unique()
+    uniq = ar.unique()
+    if not (return_inverse or return_counts):
+        return uniq
+
+    # Every element of the input is among the unique values, so its index in
+    # them is the leftmost position where it can be inserted
+    inverse = uniq.searchsorted(ar.ravel())
+    result: tuple[ndarray, ...] = (uniq,)
+    if return_inverse:
+        result += (inverse,)
+    if return_counts:
+        result += (bincount(inverse, minlength=uniq.size),)
+    return result
 
 
 ##################################
@@ -6839,7 +6870,8 @@ def argpartition(
 
     Notes
     -----
-    The current implementation falls back to `cunumeric.argsort`.
+    On CPUs the elements are selected without sorting. On GPUs the current
+    implementation falls back to `cunumeric.argsort`.
 
     See Also
     --------
@@ -6894,7 +6926,8 @@ def partition(
 
     Notes
     -----
-    The current implementation falls back to `cunumeric.sort`.
+    On CPUs the elements are selected without sorting. On GPUs the current
+    implementation falls back to `cunumeric.sort`.
 
     See Also
     --------
@@ -7623,6 +7656,25 @@ def nearest(q: float, n: int) -> tuple[float, int]:
     return (gamma, j)
 
 
+# args:
+#
+# q_arr:    [in] quantile input values nd-array;
+# n:        [in] number of elements along the quantile axis;
+# method:   [in] func(q, n) returning (gamma, j);
+#
+# return: pair of flat arrays (gammas, js) with one entry per `q`
+def quantile_positions(
+    q_arr: npt.NDArray[Any],
+    n: int,
+    method: Callable[[float, int], tuple[float, int]],
+) -> tuple[npt.NDArray[np.float64], npt.NDArray[np.int64]]:
+    gammas = np.empty(q_arr.size, dtype=np.float64)
+    js = np.empty(q_arr.size, dtype=np.int64)
+    for idx, q in enumerate(q_arr.flat):
+        (gammas[idx], js[idx]) = method(q, n)
+    return (gammas, js)
+
+
 # for the case when axis = tuple (non-singleton)
 # reshuffling might have to be done (if tuple is non-consecutive)
 # and the src array must be collapsed along that set of axes
@@ -7670,7 +7722,8 @@ def reshuffle_reshape(
 # args:
 #
 # arr:      [in] source nd-array on which quantiles are calculated;
-#                preccondition: assumed sorted!
+#                precondition: the neighbors of every `q` are in their
+#                sorted positions (e.g., partitioned);
 # q_arr:    [in] quantile input values nd-array;
 # axis:     [in] axis along which quantiles are calculated;
 # method:   [in] func(q, n) returning (gamma, j),
@@ -7733,39 +7786,28 @@ def quantile_impl(
         if qs_all.shape != qresult_shape:
             raise ValueError("wrong shape on output array")
 
-    for index, q in np.ndenumerate(q_arr):
-        (gamma, j) = method(q, n)
-        (left_pos, right_pos) = (j, j + 1)
+    # positions and weights of the neighbors of every `q`:
+    #
+    (gammas, js) = quantile_positions(q_arr, n, method)
+    left_weights = 1.0 - gammas
+    # some quantile methods may result in j==(n-1),
+    # hence (j+1) could surpass array boundary;
+    # such right neighbors do not contribute
+    #
+    right_weights = np.where(js + 1 < n, gammas, 0.0)
+    right_pos = np.minimum(js + 1, n - 1)
 
-        # (N-1) dimensional ndarray of left, right
-        # neighbor values:
-        #
-        # non-flattening approach:
-        #
-        # extract values at index=left_pos;
-        arr_1D_lvals = arr.take(left_pos, axis)
-        arr_vals_shape = arr_1D_lvals.shape
-
-        if right_pos >= n:
-            # some quantile methods may result in j==(n-1),
-            # hence (j+1) could surpass array boundary;
-            #
-            arr_1D_rvals = zeros(arr_vals_shape, dtype=arr_1D_lvals.dtype)
-        else:
-            # extract values at index=right_pos;
-            arr_1D_rvals = arr.take(right_pos, axis)
+    # extract the neighbors of all `q` values at once; the values of each
+    # `q` go to the leading dimension, followed by the remaining ones:
+    #
+    take_axis = 0 if axis is None else axis
+    arr_lvals = moveaxis(arr.take(js, axis), take_axis, 0)
+    arr_rvals = moveaxis(arr.take(right_pos, axis), take_axis, 0)
+    weights_shape = (q_arr.size,) + (1,) * (arr_lvals.ndim - 1)
 
-        # vectorized for axis != None;
-        # (non-flattening approach)
-        #
-        if len(index) == 0:
-            left = (1.0 - gamma) * arr_1D_lvals.reshape(qs_all.shape)
-            right = gamma * arr_1D_rvals.reshape(qs_all.shape)
-            qs_all[...] = left + right
-        else:
-            left = (1.0 - gamma) * arr_1D_lvals.reshape(qs_all[index].shape)
-            right = gamma * arr_1D_rvals.reshape(qs_all[index].shape)
-            qs_all[index] = left + right
+    left = arr_lvals * left_weights.reshape(weights_shape)
+    right = arr_rvals * right_weights.reshape(weights_shape)
+    qs_all[...] = (left + right).reshape(qresult_shape)
 
     return qs_all
 
@@ -7897,21 +7939,26 @@ def quantile(
     #
     q_arr = np.asarray(q)
 
-    # in the future k-sort (partition)
-    # might be faster, for now it uses sort
-    # arr = partition(arr, k = floor(nq), axis = real_axis)
-    # but that would require a k-sort call for each `q`!
-    # too expensive for many `q` values...
-    # if no axis given then elements are sorted as a 1D array
+    if a_rr.dtype.kind == "c":
+        raise TypeError("input array cannot be of complex type")
+
+    # only the neighbors of every `q` need to be in their sorted positions,
+    # so we select all of them with a single partition instead of sorting;
+    # if no axis given then elements are partitioned as a 1D array
     #
-    if overwrite_input:
-        a_rr.sort(axis=real_axis)
+    n = a_rr.size if real_axis is None else a_rr.shape[real_axis]
+    if n == 0:
         arr = a_rr
     else:
-        arr = sort(a_rr, axis=real_axis)
-
-    if arr.dtype.kind == "c":
-        raise TypeError("input array cannot be of complex type")
+        (_, js) = quantile_positions(q_arr, n, dict_methods[method])
+        kths = tuple(
+            int(k) for k in np.unique(np.concatenate((js, js + 1))) if k < n
+        )
+        if overwrite_input and real_axis is not None:
+            a_rr.partition(kths, axis=real_axis)
+            arr = a_rr
+        else:
+            arr = partition(a_rr, kths, axis=real_axis)
 
     # return type dependency on arr.dtype:
     #
@@ -8200,7 +8247,10 @@ def histogram(
         inputs=(x, bins_array, weights_array),
     )
     hist._thunk.histogram(
-        x._thunk, bins_array._thunk, weights=weights_array._thunk
+        x._thunk,
+        bins_array._thunk,
+        weights=weights_array._thunk,
+        uniform=np.ndim(bins) == 0,
     )
 
     # handle (density = True):
@@ -16,6 +16,7 @@ from __future__ import annotations
 
 import struct
 import warnings
+import weakref
 from functools import reduce
 from typing import TYPE_CHECKING, Any, Optional, Sequence, Union
 
@@ -84,6 +85,11 @@ class Runtime(object):
         self._cached_point_types: dict[DIMENSION, ty.Dtype] = dict()
         # Maps value types to struct types used in argmin/argmax
         self._cached_argred_types: dict[ty.Dtype, ty.Dtype] = dict()
+        # Maps value types to struct types used in single-pass variance
+        self._cached_welford_types: dict[ty.Dtype, ty.Dtype] = dict()
+        # Arrays with pending fused elementwise expressions, in the order in
+        # which the expressions were deferred
+        self.pending_fusions: list[weakref.ref[DeferredArray]] = []
 
     @property
     def num_procs(self) -> int:
@@ -133,6 +139,30 @@ class Runtime(object):
         )
         return argred_dtype
 
+    def get_welford_type(self, value_dtype: ty.Dtype) -> ty.Dtype:
+        cached = self._cached_welford_types.get(value_dtype)
+        if cached is not None:
+            return cached
+        # (count, mean, M2) of the values reduced so far
+        welford_dtype = ty.struct_type(
+            [ty.int64, value_dtype, value_dtype], True
+        )
+        self._cached_welford_types[value_dtype] = welford_dtype
+        self.cunumeric_lib.cunumeric_register_welford_op(
+            welford_dtype.uid, value_dtype.code
+        )
+        return welford_dtype
+
+    def flush_fused_elementwise(self) -> None:
+        # Launching an expression doesn't defer anything new, so the list can
+        # be swapped out before the launches. Expressions of arrays that are
+        # gone are dropped, as nobody can read their results.
+        pending, self.pending_fusions = self.pending_fusions, []
+        for ref in pending:
+            thunk = ref()
+            if thunk is not None:
+                thunk._launch_fused()
+
     def _report_coverage(self) -> None:
         total = len(self.api_calls)
         implemented = sum(int(impl) for (_, _, impl) in self.api_calls)
@@ -457,7 +487,7 @@ class Runtime(object):
         store = self.legate_context.create_store(
             dtype, shape=shape, optimize_scalar=True
         )
-        return DeferredArray(self, store)
+        return DeferredArray(self, store, exposed=False)
 
     def create_eager_thunk(
         self,
@@ -88,6 +88,19 @@ class CunumericRuntimeSettings(Settings):
         """,
     )
 
+    fuse_elementwise: PrioritizedSetting[bool] = PrioritizedSetting(
+        "fuse_elementwise",
+        "CUNUMERIC_FUSE_ELEMENTWISE",
+        default=False,
+        convert=convert_bool,
+        help="""
+        Defer chains of elementwise unary and binary operations on
+        floating-point arrays and launch each chain as a single fused task,
+        so that temporaries are never written to memory. A chain is launched
+        as soon as any of its results, or any other array, is used otherwise.
+        """,
+    )
+
     fast_math: EnvOnlySetting[int] = EnvOnlySetting(
         "fast_math",
         "CUNUMERIC_FAST_MATH",
@@ -97,7 +110,9 @@ class CunumericRuntimeSettings(Settings):
         Enable certain optimized execution modes for floating-point math
         operations, that may violate strict IEEE specifications. Currently this
         flag enables the acceleration of single-precision cuBLAS routines using
-        TF32 tensor cores.
+        TF32 tensor cores, and vectorized CPU implementations of exp, exp2 and
+        log, whose results are within 1.5 ULPs of the exact ones rather than
+        matching the system math library to the bit.
 
         This is a read-only environment variable setting used by the runtime.
         """,
@@ -14,7 +14,7 @@
 #
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Union, cast
+from typing import TYPE_CHECKING, Callable, Union, cast
 
 from legate.core import types as ty
 from numpy.core.multiarray import (  # type: ignore [attr-defined]
@@ -27,8 +27,12 @@ if TYPE_CHECKING:
     from .deferred import DeferredArray
 
 
+# Runs a task operating along the last axis of its input
+LastAxisTask = Callable[["DeferredArray", "DeferredArray"], None]
+
+
 def sort_flattened(
-    output: DeferredArray, input: DeferredArray, argsort: bool, stable: bool
+    output: DeferredArray, input: DeferredArray, task: LastAxisTask
 ) -> None:
     flattened = cast("DeferredArray", input.reshape((input.size,), order="C"))
 
@@ -39,7 +43,7 @@ def sort_flattened(
             flattened.shape, dtype=output.base.type, inputs=(flattened,)
         ),
     )
-    sort(sort_result, flattened, argsort, stable=stable)
+    task(sort_result, flattened)
     output.base = sort_result.base
     output.numpy_array = None
 
@@ -49,7 +53,7 @@ def sort_swapped(
     input: DeferredArray,
     argsort: bool,
     sort_axis: int,
-    stable: bool,
+    task: LastAxisTask,
 ) -> None:
     sort_axis = normalize_axis_index(sort_axis, input.ndim)
 
@@ -74,15 +78,36 @@ def sort_swapped(
                 inputs=(swapped_copy,),
             ),
         )
-        sort(sort_result, swapped_copy, argsort, stable=stable)
+        task(sort_result, swapped_copy)
         output.base = sort_result.swapaxes(input.ndim - 1, sort_axis).base
         output.numpy_array = None
     else:
-        sort(swapped_copy, swapped_copy, argsort, stable=stable)
+        task(swapped_copy, swapped_copy)
         output.base = swapped_copy.swapaxes(input.ndim - 1, sort_axis).base
         output.numpy_array = None
 
 
+def sort_along_axis(
+    output: DeferredArray,
+    input: DeferredArray,
+    argsort: bool,
+    axis: Union[int, None],
+    task: LastAxisTask,
+) -> None:
+    if axis is None and input.ndim > 1:
+        sort_flattened(output, input, task)
+    else:
+        if axis is None:
+            computed_axis = 0
+        else:
+            computed_axis = normalize_axis_index(axis, input.ndim)
+
+        if computed_axis == input.ndim - 1:
+            task(output, input)
+        else:
+            sort_swapped(output, input, argsort, computed_axis, task)
+
+
 def sort_task(
     output: DeferredArray, input: DeferredArray, argsort: bool, stable: bool
 ) -> None:
@@ -122,15 +147,59 @@ def sort(
     axis: Union[int, None] = -1,
     stable: bool = False,
 ) -> None:
-    if axis is None and input.ndim > 1:
-        sort_flattened(output, input, argsort, stable)
+    def task(output: DeferredArray, input: DeferredArray) -> None:
+        sort_task(output, input, argsort, stable)
+
+    sort_along_axis(output, input, argsort, axis, task)
+
+
+def partition_task(
+    output: DeferredArray,
+    input: DeferredArray,
+    kths: tuple[int, ...],
+    argpartition: bool,
+) -> None:
+    task = output.context.create_auto_task(CuNumericOpCode.PARTITION)
+
+    uses_unbound_output = output.runtime.num_procs > 1 and input.ndim == 1
+
+    task.add_input(input.base)
+    if uses_unbound_output:
+        unbound = output.runtime.create_unbound_thunk(
+            dtype=output.base.type, ndim=1
+        )
+        task.add_output(unbound.base)
     else:
-        if axis is None:
-            computed_axis = 0
-        else:
-            computed_axis = normalize_axis_index(axis, input.ndim)
+        task.add_output(output.base)
+        task.add_alignment(output.base, input.base)
 
-        if computed_axis == input.ndim - 1:
-            sort_task(output, input, argsort, stable)
-        else:
-            sort_swapped(output, input, argsort, computed_axis, stable)
+    if output.runtime.num_procs > 1:
+        task.add_cpu_communicator()
+
+    task.add_scalar_arg(argpartition, ty.bool_)  # return indices flag
+    task.add_scalar_arg(input.base.shape, (ty.int64,))
+    task.add_scalar_arg(kths, (ty.int64,))
+    task.execute()
+
+    if uses_unbound_output:
+        output.base = unbound.base
+        output.numpy_array = None
+
+
+def partition(
+    output: DeferredArray,
+    input: DeferredArray,
+    kths: tuple[int, ...],
+    argpartition: bool,
+    axis: Union[int, None] = -1,
+) -> None:
+    # kths must be sorted, unique and non-negative
+    if output.runtime.num_gpus > 0:
+        # there is no GPU variant of the partition task yet
+        sort(output, input, argpartition, axis)
+        return
+
+    def task(output: DeferredArray, input: DeferredArray) -> None:
+        partition_task(output, input, kths, argpartition)
+
+    sort_along_axis(output, input, argpartition, axis, task)
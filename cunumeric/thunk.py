@@ -738,5 +738,7 @@ class NumPyThunk(ABC):
         ...
 
     @abstractmethod
-    def histogram(self, src: Any, bins: Any, weights: Any) -> None:
+    def histogram(
+        self, src: Any, bins: Any, weights: Any, uniform: bool = False
+    ) -> None:
         ...
@@ -21,6 +21,7 @@ option(BUILD_SHARED_LIBS "Build cuNumeric shared libraries" ON)
 option(cunumeric_EXCLUDE_TBLIS_FROM_ALL "Exclude tblis targets from cuNumeric's 'all' target" OFF)
 option(cunumeric_EXCLUDE_OPENBLAS_FROM_ALL "Exclude OpenBLAS targets from cuNumeric's 'all' target" OFF)
 option(cunumeric_EXCLUDE_LEGATE_CORE_FROM_ALL "Exclude legate.core targets from cuNumeric's 'all' target" OFF)
+option(cunumeric_BUILD_BENCHMARKS "Build the cunumeric_bench microbenchmarks of the task bodies" OFF)
 
 ##############################################################################
 # - Project definition -------------------------------------------------------
@@ -106,6 +107,8 @@ include(cmake/thirdparty/get_openblas.cmake)
 
 include(cmake/thirdparty/get_tblis.cmake)
 
+include(cmake/thirdparty/get_pocketfft.cmake)
+
 ##############################################################################
 # - cuNumeric ----------------------------------------------------------------
 
@@ -131,6 +134,8 @@ list(APPEND cunumeric_SOURCES
   src/cunumeric/unary/unary_op.cc
   src/cunumeric/unary/unary_red.cc
   src/cunumeric/unary/convert.cc
+  src/cunumeric/unary/vector_math.cc
+  src/cunumeric/fused/fused_elementwise.cc
   src/cunumeric/nullary/arange.cc
   src/cunumeric/nullary/eye.cc
   src/cunumeric/nullary/fill.cc
@@ -165,6 +170,7 @@ list(APPEND cunumeric_SOURCES
   src/cunumeric/set/unique_reduce.cc
   src/cunumeric/stat/bincount.cc
   src/cunumeric/convolution/convolve.cc
+  src/cunumeric/fft/fft.cc
   src/cunumeric/transform/flip.cc
   src/cunumeric/arg_redop_register.cc
   src/cunumeric/mapper.cc
@@ -186,6 +192,7 @@ if(Legion_USE_OpenMP)
     src/cunumeric/unary/scalar_unary_red_omp.cc
     src/cunumeric/unary/unary_red_omp.cc
     src/cunumeric/unary/convert_omp.cc
+    src/cunumeric/fused/fused_elementwise_omp.cc
     src/cunumeric/nullary/arange_omp.cc
     src/cunumeric/nullary/eye_omp.cc
     src/cunumeric/nullary/fill_omp.cc
@@ -217,6 +224,7 @@ if(Legion_USE_OpenMP)
     src/cunumeric/set/unique_reduce_omp.cc
     src/cunumeric/stat/bincount_omp.cc
     src/cunumeric/convolution/convolve_omp.cc
+    src/cunumeric/fft/fft_omp.cc
     src/cunumeric/transform/flip_omp.cc
     src/cunumeric/stat/histogram_omp.cc
   )
@@ -235,6 +243,7 @@ if(Legion_USE_CUDA)
     src/cunumeric/unary/unary_red.cu
     src/cunumeric/unary/unary_op.cu
     src/cunumeric/unary/convert.cu
+    src/cunumeric/fused/fused_elementwise.cu
     src/cunumeric/nullary/arange.cu
     src/cunumeric/nullary/eye.cu
     src/cunumeric/nullary/fill.cu
@@ -278,12 +287,14 @@ endif()
 # Add `src/cunumeric/sort/sort.mk` sources
 list(APPEND cunumeric_SOURCES
   src/cunumeric/sort/sort.cc
+  src/cunumeric/sort/partition.cc
   src/cunumeric/sort/searchsorted.cc
 )
 
 if(Legion_USE_OpenMP)
   list(APPEND cunumeric_SOURCES
     src/cunumeric/sort/sort_omp.cc
+    src/cunumeric/sort/partition_omp.cc
     src/cunumeric/sort/searchsorted_omp.cc
   )
 endif()
@@ -328,7 +339,13 @@ if(Legion_USE_CUDA OR cunumeric_cuRAND_INCLUDE_DIR)
     src/cunumeric/random/randutil/generator_host.cc
     src/cunumeric/random/randutil/generator_host_straightforward.cc
     src/cunumeric/random/randutil/generator_host_advanced.cc
+    src/cunumeric/random/randutil/generator_host_batch.cc
   )
+  if(Legion_USE_OpenMP)
+    list(APPEND cunumeric_SOURCES
+      src/cunumeric/random/bitgenerator_omp.cc
+    )
+  endif()
   if(Legion_USE_CUDA)
     list(APPEND cunumeric_SOURCES
       src/cunumeric/random/bitgenerator.cu
@@ -362,6 +379,11 @@ list(APPEND cunumeric_CUDA_OPTIONS --expt-relaxed-constexpr)
 list(APPEND cunumeric_CXX_OPTIONS -Wno-deprecated-declarations)
 list(APPEND cunumeric_CUDA_OPTIONS -Wno-deprecated-declarations)
 
+# The vectorized math kernels rely on if-conversion of their floating-point selects, which
+# compilers only do when they can ignore floating-point exceptions
+set_source_files_properties(src/cunumeric/unary/vector_math.cc
+                            PROPERTIES COMPILE_OPTIONS -fno-trapping-math)
+
 add_library(cunumeric ${cunumeric_SOURCES})
 add_library(cunumeric::cunumeric ALIAS cunumeric)
 
@@ -420,6 +442,7 @@ target_compile_definitions(cunumeric
 target_include_directories(cunumeric
   PRIVATE
     $<BUILD_INTERFACE:${cunumeric_SOURCE_DIR}/src>
+    $<BUILD_INTERFACE:${cunumeric_POCKETFFT_INCLUDE_DIR}>
   INTERFACE
     $<INSTALL_INTERFACE:include>
 )
@@ -438,6 +461,47 @@ SECTIONS
   target_link_options(cunumeric PRIVATE "${CMAKE_CURRENT_BINARY_DIR}/fatbin.ld")
 endif()
 
+##############################################################################
+# - microbenchmarks ----------------------------------------------------------
+
+# The benchmarks compile the host task bodies into a standalone executable and
+# run them on synthetic stores, so they don't link against libcunumeric
+if(cunumeric_BUILD_BENCHMARKS)
+  if(Legion_BOUNDS_CHECKS)
+    message(FATAL_ERROR "cunumeric_bench can't be built with Legion_BOUNDS_CHECKS")
+  endif()
+
+  add_executable(cunumeric_bench
+    benchmarks/cpp/bench_main.cc
+    benchmarks/cpp/bench_binary_op.cc
+    benchmarks/cpp/bench_scan.cc
+    benchmarks/cpp/bench_sort.cc
+    benchmarks/cpp/bench_unary_op.cc
+    benchmarks/cpp/bench_unary_red.cc
+    # Defines the identities of the argmin/argmax and Welford reductions
+    src/cunumeric/arg_redop_register.cc
+    src/cunumeric/unary/vector_math.cc)
+
+  set_target_properties(cunumeric_bench
+             PROPERTIES CXX_STANDARD                        17
+                        CXX_STANDARD_REQUIRED               ON
+                        POSITION_INDEPENDENT_CODE           ON)
+
+  target_link_libraries(cunumeric_bench
+    PRIVATE legate::core
+            $<TARGET_NAME_IF_EXISTS:conda_env>
+            $<TARGET_NAME_IF_EXISTS:OpenMP::OpenMP_CXX>)
+
+  target_compile_options(cunumeric_bench
+    PRIVATE "$<$<COMPILE_LANGUAGE:CXX>:${cunumeric_CXX_OPTIONS}>")
+
+  target_compile_definitions(cunumeric_bench
+    PRIVATE "$<$<COMPILE_LANGUAGE:CXX>:${cunumeric_CXX_DEFS}>")
+
+  target_include_directories(cunumeric_bench
+    PRIVATE ${cunumeric_SOURCE_DIR}/src ${cunumeric_SOURCE_DIR}/benchmarks/cpp)
+endif()
+
 ##############################################################################
 # - install targets-----------------------------------------------------------
 
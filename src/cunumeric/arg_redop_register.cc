@@ -49,6 +49,16 @@ DEFINE_IDENTITIES(uint64_t)
 #undef DEFINE_ARGMIN_IDENTITY
 #undef DEFINE_IDENTITIES
 
+#define DEFINE_WELFORD_IDENTITY(TYPE)                         \
+  template <>                                                 \
+  const WelfordState<TYPE> WelfordReduction<TYPE>::identity = \
+    WelfordState<TYPE>(0, TYPE(0), TYPE(0));
+
+DEFINE_WELFORD_IDENTITY(float)
+DEFINE_WELFORD_IDENTITY(double)
+
+#undef DEFINE_WELFORD_IDENTITY
+
 /*static*/ int32_t register_reduction_op_fn::register_reduction_op_fn::next_reduction_operator_id()
 {
   static int32_t next_redop_id = 0;
@@ -66,6 +76,12 @@ void cunumeric_register_reduction_op(int32_t type_uid, int32_t _elem_type_code)
   auto elem_type_code = static_cast<legate::Type::Code>(_elem_type_code);
   legate::type_dispatch(elem_type_code, cunumeric::register_reduction_op_fn{}, type_uid);
 }
+
+void cunumeric_register_welford_op(int32_t type_uid, int32_t _elem_type_code)
+{
+  auto elem_type_code = static_cast<legate::Type::Code>(_elem_type_code);
+  legate::type_dispatch(elem_type_code, cunumeric::register_welford_op_fn{}, type_uid);
+}
 }
 
 #endif
@@ -23,4 +23,10 @@ void cunumeric_register_reduction_op(int32_t type_uid, int32_t _elem_type_code)
   auto elem_type_code = static_cast<legate::Type::Code>(_elem_type_code);
   legate::type_dispatch(elem_type_code, cunumeric::register_reduction_op_fn{}, type_uid);
 }
+
+void cunumeric_register_welford_op(int32_t type_uid, int32_t _elem_type_code)
+{
+  auto elem_type_code = static_cast<legate::Type::Code>(_elem_type_code);
+  legate::type_dispatch(elem_type_code, cunumeric::register_welford_op_fn{}, type_uid);
+}
 }
@@ -30,6 +30,25 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   out[idx] = func(in1[idx], in2[idx]);
 }
 
+// A scalar input is passed by its pointer, as its value lives in device memory
+template <typename Function, typename LHS, typename RHS1, typename RHS2>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scalar_in1_kernel(size_t volume, Function func, LHS* out, const RHS1* in1, const RHS2* in2)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  out[idx] = func(*in1, in2[idx]);
+}
+
+template <typename Function, typename LHS, typename RHS1, typename RHS2>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scalar_in2_kernel(size_t volume, Function func, LHS* out, const RHS1* in1, const RHS2* in2)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  out[idx] = func(in1[idx], *in2);
+}
+
 template <typename Function,
           typename WriteAcc,
           typename ReadAcc1,
@@ -64,16 +83,28 @@ struct BinaryOpImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
                   AccessorRO<RHS2, DIM> in2,
                   const Pitches<DIM - 1>& pitches,
                   const Rect<DIM>& rect,
-                  bool dense) const
+                  BinaryOpLayout layout) const
   {
     size_t volume       = rect.volume();
     const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
     auto stream         = get_cached_stream();
-    if (dense) {
+    if (layout == BinaryOpLayout::DENSE) {
       auto outptr = out.ptr(rect);
       auto in1ptr = in1.ptr(rect);
       auto in2ptr = in2.ptr(rect);
       dense_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(volume, func, outptr, in1ptr, in2ptr);
+    } else if (layout == BinaryOpLayout::SCALAR_IN1) {
+      auto outptr = out.ptr(rect);
+      auto in1ptr = in1.ptr(rect.lo);
+      auto in2ptr = in2.ptr(rect);
+      scalar_in1_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        volume, func, outptr, in1ptr, in2ptr);
+    } else if (layout == BinaryOpLayout::SCALAR_IN2) {
+      auto outptr = out.ptr(rect);
+      auto in1ptr = in1.ptr(rect);
+      auto in2ptr = in2.ptr(rect.lo);
+      scalar_in2_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        volume, func, outptr, in1ptr, in2ptr);
     } else {
       generic_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
         volume, func, out, in1, in2, pitches, rect);
@@ -21,6 +21,16 @@
 
 namespace cunumeric {
 
+// Operand layouts that the task bodies have their own loops for. A scalar operand has a zero
+// stride along every dimension, which is how Python scalars and 0-d arrays look once they
+// are broadcast to the shape of the output.
+enum class BinaryOpLayout : int {
+  DENSE      = 0,  // All operands are dense
+  SCALAR_IN1 = 1,  // The first input is a scalar and the other operands are dense
+  SCALAR_IN2 = 2,  // The second input is a scalar and the other operands are dense
+  STRIDED    = 3,  // Anything else, including row and column vector broadcasts
+};
+
 struct BinaryOpArgs {
   const Array& in1;
   const Array& in2;
@@ -16,6 +16,7 @@
 
 #include "cunumeric/binary/binary_op.h"
 #include "cunumeric/binary/binary_op_template.inl"
+#include "cunumeric/omp_help.h"
 
 namespace cunumeric {
 
@@ -34,21 +35,54 @@ struct BinaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
                   AccessorRO<RHS2, DIM> in2,
                   const Pitches<DIM - 1>& pitches,
                   const Rect<DIM>& rect,
-                  bool dense) const
+                  BinaryOpLayout layout) const
   {
     const size_t volume = rect.volume();
-    if (dense) {
+    if (layout == BinaryOpLayout::DENSE) {
       auto outptr = out.ptr(rect);
       auto in1ptr = in1.ptr(rect);
       auto in2ptr = in2.ptr(rect);
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(in1ptr[idx], in2ptr[idx]);
-    } else {
+    } else if (layout == BinaryOpLayout::SCALAR_IN1) {
+      auto outptr       = out.ptr(rect);
+      const RHS1 in1val = in1[rect.lo];
+      auto in2ptr       = in2.ptr(rect);
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(in1val, in2ptr[idx]);
+    } else if (layout == BinaryOpLayout::SCALAR_IN2) {
+      auto outptr       = out.ptr(rect);
+      auto in1ptr       = in1.ptr(rect);
+      const RHS2 in2val = in2[rect.lo];
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in1[p], in2[p]);
-      }
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(in1ptr[idx], in2val);
+    } else {
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in1_stride = inner_stride(in1, rect);
+      const size_t in2_stride = inner_stride(in2, rect);
+      const bool contiguous   = out_stride == 1 && in1_stride == 1 && in2_stride == 1;
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto in1ptr = in1.ptr(p);
+        auto in2ptr = in2.ptr(p);
+        // Inputs broadcast along the rows (e.g., column vectors) are loaded once per row
+        if (in1_stride == 0) {
+          const RHS1 in1val = *in1ptr;
+          for (size_t idx = 0; idx < count; ++idx)
+            outptr[idx * out_stride] = func(in1val, in2ptr[idx * in2_stride]);
+        } else if (in2_stride == 0) {
+          const RHS2 in2val = *in2ptr;
+          for (size_t idx = 0; idx < count; ++idx)
+            outptr[idx * out_stride] = func(in1ptr[idx * in1_stride], in2val);
+        } else if (contiguous) {
+          // The rows are contiguous but the stores aren't (e.g., a row vector broadcast
+          // along the outer dimensions)
+          for (size_t idx = 0; idx < count; ++idx) outptr[idx] = func(in1ptr[idx], in2ptr[idx]);
+        } else {
+          for (size_t idx = 0; idx < count; ++idx)
+            outptr[idx * out_stride] = func(in1ptr[idx * in1_stride], in2ptr[idx * in2_stride]);
+        }
+      });
     }
   }
 };
@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cunumeric/binary/binary_op.h"
 #include "cunumeric/binary/binary_op_util.h"
+#include "cunumeric/nd_iterator.h"
 #include "cunumeric/pitches.h"
 
 namespace cunumeric {
@@ -49,17 +50,25 @@ struct BinaryOpImpl {
     auto in1 = args.in1.read_accessor<RHS1, DIM>(rect);
     auto in2 = args.in2.read_accessor<RHS2, DIM>(rect);
 
+    // Check to see if this is dense or not. An input broadcast from a scalar doesn't prevent
+    // dense execution, as its value is simply loaded once. No dense execution if we're doing
+    // bounds checks.
+    auto layout = BinaryOpLayout::STRIDED;
 #ifndef LEGATE_BOUNDS_CHECKS
-    // Check to see if this is dense or not
-    bool dense = out.accessor.is_dense_row_major(rect) && in1.accessor.is_dense_row_major(rect) &&
-                 in2.accessor.is_dense_row_major(rect);
-#else
-    // No dense execution if we're doing bounds checks
-    bool dense = false;
+    if (out.accessor.is_dense_row_major(rect)) {
+      bool in1_dense = in1.accessor.is_dense_row_major(rect);
+      bool in2_dense = in2.accessor.is_dense_row_major(rect);
+      if (in1_dense && in2_dense)
+        layout = BinaryOpLayout::DENSE;
+      else if (in1_dense && is_scalar_broadcast(in2, rect))
+        layout = BinaryOpLayout::SCALAR_IN2;
+      else if (in2_dense && is_scalar_broadcast(in1, rect))
+        layout = BinaryOpLayout::SCALAR_IN1;
+    }
 #endif
 
     OP func{args.args};
-    BinaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in1, in2, pitches, rect, dense);
+    BinaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in1, in2, pitches, rect, layout);
   }
 
   template <Type::Code CODE, int DIM, std::enable_if_t<!BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
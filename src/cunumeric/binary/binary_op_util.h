@@ -17,6 +17,7 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/isnan.h"
 
 namespace cunumeric {
 
@@ -475,9 +476,10 @@ struct BinaryOp<BinaryOpCode::ISCLOSE, CODE> {
 
   BinaryOp(const std::vector<legate::Store>& args)
   {
-    assert(args.size() == 2);
-    rtol_ = args[0].scalar<double>();
-    atol_ = args[1].scalar<double>();
+    assert(args.size() == 3);
+    rtol_      = args[0].scalar<double>();
+    atol_      = args[1].scalar<double>();
+    equal_nan_ = args[2].scalar<bool>();
   }
 
   template <typename T = VAL, std::enable_if_t<!legate::is_complex_type<T>::value>* = nullptr>
@@ -485,6 +487,7 @@ struct BinaryOp<BinaryOpCode::ISCLOSE, CODE> {
   {
     using std::fabs;
     using std::isinf;
+    if (equal_nan_ && is_nan(a) && is_nan(b)) return true;
     if (isinf(a) || isinf(b)) return a == b;
     return fabs(static_cast<double>(a) - static_cast<double>(b)) <=
            atol_ + rtol_ * static_cast<double>(fabs(b));
@@ -493,11 +496,17 @@ struct BinaryOp<BinaryOpCode::ISCLOSE, CODE> {
   template <typename T = VAL, std::enable_if_t<legate::is_complex_type<T>::value>* = nullptr>
   constexpr bool operator()(const T& a, const T& b) const
   {
+    using std::isfinite;
+    if (equal_nan_ && is_nan(a) && is_nan(b)) return true;
+    // abs(a - b) is NaN for equal infinities, so values that are not finite compare exactly
+    if (!isfinite(a.real()) || !isfinite(a.imag()) || !isfinite(b.real()) || !isfinite(b.imag()))
+      return a == b;
     return static_cast<double>(abs(a - b)) <= atol_ + rtol_ * static_cast<double>(abs(b));
   }
 
   double rtol_{0};
   double atol_{0};
+  bool equal_nan_{false};
 };
 
 template <legate::Type::Code CODE>
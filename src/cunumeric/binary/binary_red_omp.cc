@@ -16,6 +16,12 @@
 
 #include "cunumeric/binary/binary_red.h"
 #include "cunumeric/binary/binary_red_template.inl"
+#include "cunumeric/execution_policy/reduction/scalar_reduction.h"
+#include "cunumeric/nd_iterator.h"
+#include "cunumeric/omp_help.h"
+
+#include <atomic>
+#include <omp.h>
 
 namespace cunumeric {
 
@@ -35,23 +41,53 @@ struct BinaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
                   const Rect<DIM>& rect,
                   bool dense) const
   {
-    size_t volume = rect.volume();
-    bool result   = true;
+    const size_t volume = rect.volume();
+    // Any mismatch decides the result, so the threads poll a shared flag between blocks and
+    // stop as soon as one of them has seen a mismatch
+    std::atomic<bool> result{true};
     if (dense) {
       auto in1ptr = in1.ptr(rect);
       auto in2ptr = in2.ptr(rect);
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx)
-        if (!func(in1ptr[idx], in2ptr[idx])) result = false;
+#pragma omp parallel
+      {
+        auto [start, stop] = thread_range(volume);
+        for (size_t block = start; block < stop; block += EARLY_EXIT_BLOCK_SIZE) {
+          if (!result.load(std::memory_order_relaxed)) break;
+          const size_t block_stop = std::min(block + EARLY_EXIT_BLOCK_SIZE, stop);
+          bool equal              = true;
+          for (size_t idx = block; idx < block_stop; ++idx)
+            equal &= static_cast<bool>(func(in1ptr[idx], in2ptr[idx]));
+          if (!equal) {
+            result.store(false, std::memory_order_relaxed);
+            break;
+          }
+        }
+      }
     } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        if (!func(in1[point], in2[point])) result = false;
+      const size_t stride1 = inner_stride(in1, rect);
+      const size_t stride2 = inner_stride(in2, rect);
+#pragma omp parallel
+      {
+        auto [start, stop] = thread_range(volume);
+        for (size_t block = start; block < stop; block += EARLY_EXIT_BLOCK_SIZE) {
+          if (!result.load(std::memory_order_relaxed)) break;
+          const size_t block_stop = std::min(block + EARLY_EXIT_BLOCK_SIZE, stop);
+          bool equal              = true;
+          for_each_row(rect, pitches, block, block_stop, [&](const auto& point, size_t count) {
+            auto in1ptr = in1.ptr(point);
+            auto in2ptr = in2.ptr(point);
+            for (size_t idx = 0; idx < count; ++idx)
+              equal &= static_cast<bool>(func(in1ptr[idx * stride1], in2ptr[idx * stride2]));
+          });
+          if (!equal) {
+            result.store(false, std::memory_order_relaxed);
+            break;
+          }
+        }
       }
     }
 
-    out.reduce(0, result);
+    out.reduce(0, result.load());
   }
 };
 
@@ -17,6 +17,7 @@
 #include "cunumeric/divmod.h"
 #include "cunumeric/convolution/convolve.h"
 #include "cunumeric/convolution/convolve_template.inl"
+#include "cunumeric/convolution/convolve_cpu.inl"
 
 namespace cunumeric {
 
@@ -33,13 +34,11 @@ struct ConvolveImplBody<VariantKind::CPU, CODE, DIM> {
                   AccessorRO<VAL, DIM> in,
                   const Rect<DIM>& root_rect,
                   const Rect<DIM>& subrect,
-                  const Rect<DIM>& filter_rect) const
+                  const Rect<DIM>& filter_rect,
+                  const Point<DIM>& centers) const
   {
     const Point<DIM> one = Point<DIM>::ONES();
     Point<DIM> extents = filter_rect.hi + one;
-    Point<DIM> centers;
-    for (int d = 0; d < DIM; d++)
-      centers[d] = extents[d] / 2;
     Point<DIM> output = subrect.lo;
     const size_t output_volume = subrect.volume();
     const size_t filter_volume = filter_rect.volume();
@@ -82,13 +81,17 @@ struct ConvolveImplBody<VariantKind::CPU, CODE, DIM> {
                   AccessorRO<VAL, DIM> in,
                   const Rect<DIM>& root_rect,
                   const Rect<DIM>& subrect,
-                  const Rect<DIM>& filter_rect) const
+                  const Rect<DIM>& filter_rect,
+                  const Point<DIM>& centers) const
   {
+    // Large filters are cheaper to apply in the frequency domain
+    if (try_fft_convolution<VAL, DIM>(
+          out, filter, in, root_rect, subrect, filter_rect, centers, thrust::host))
+      return;
+
     const Point<DIM> zero = Point<DIM>::ZEROES();
     const Point<DIM> one  = Point<DIM>::ONES();
     Point<DIM> extents    = filter_rect.hi - filter_rect.lo + one;
-    Point<DIM> centers;
-    for (int d = 0; d < DIM; d++) centers[d] = extents[d] / 2;
 
     // Compute the tiles for the L2 cache
     Point<DIM> l2_output_tile, l2_filter_tile;
@@ -629,8 +629,9 @@ __host__ static inline void launch_small_tile_kernel(AccessorWO<VAL, DIM> out,
     max_smem_size = half_smem;
     halved        = true;
   }
+  // The input tile covers the filter footprint of every output in the tile
   Point<DIM> padding;
-  for (int d = 0; d < DIM; d++) padding[d] = 2 * centers[d];
+  for (int d = 0; d < DIM; d++) padding[d] = extents[d] - 1;
   Point<DIM> bounds = subrect.hi - subrect.lo + Point<DIM>::ONES();
   smem_size         = roundup_tile<VAL, DIM>(tile, bounds, padding, max_smem_size);
   // At this point we've got the tile size that we're going to compute
@@ -649,7 +650,7 @@ __host__ static inline void launch_small_tile_kernel(AccessorWO<VAL, DIM> out,
     args.block_pitches[d] = FastDivmodU64(tile_pitch);
     tile_pitch *= tile[d];
     args.delta_lo[d]      = centers[d];
-    args.delta_hi[d]      = tile[d] + centers[d] - 1;
+    args.delta_hi[d]      = tile[d] + extents[d] - centers[d] - 2;
     args.input_pitches[d] = FastDivmodU64(input_pitch);
     input_pitch *= (args.delta_lo[d] + args.delta_hi[d] + 1);
     args.filter_centers[d] = centers[d];
@@ -684,7 +685,8 @@ __host__ void direct_convolution(AccessorWO<VAL, DIM> out,
                                  AccessorRO<VAL, DIM> in,
                                  const Rect<DIM>& root_rect,
                                  const Rect<DIM>& subrect,
-                                 const Rect<DIM>& filter_rect)
+                                 const Rect<DIM>& filter_rect,
+                                 const Point<DIM>& filter_centers)
 {
   constexpr int THREADVALS = THREAD_OUTPUTS(VAL);
   // Get the maximum amount of shared memory per threadblock
@@ -725,26 +727,29 @@ __host__ void direct_convolution(AccessorWO<VAL, DIM> out,
   }
   unsigned extents[DIM];
   unsigned centers[DIM];
+  unsigned halos[DIM];
   for (int d = 0; d < DIM; d++) {
     assert(filter_rect.lo[d] == 0);
     extents[d] = filter_rect.hi[d] + 1;
-    centers[d] = static_cast<coord_t>(extents[d] / 2);
+    centers[d] = static_cast<unsigned>(filter_centers[d]);
+    // Size the tiles as if the filter was centered, whatever the mode is
+    halos[d] = extents[d] / 2;
   }
   Point<DIM> tile;
   for (int d = DIM - 1; d >= 0; d--) {
     // Make sure that each tile is at least double the size of the filter
     // so that we can get some savings in bandwidth needed
-    tile[d] = 2 * centers[d];
+    tile[d] = 2 * halos[d];
     if (d == (DIM - 1)) {
       // In order to maximize bandwidth, we want to make sure we're loading at
       // least 128B of contiguous memory along the last axis (row-major) of input
       const unsigned min_contig_elmts = 128 / sizeof(VAL);
-      if ((tile[d] + 2 * centers[d]) < min_contig_elmts)
-        tile[d] = min_contig_elmts - 2 * centers[d];
+      if ((tile[d] + 2 * halos[d]) < min_contig_elmts)
+        tile[d] = min_contig_elmts - 2 * halos[d];
     }
   }
   unsigned smem_size = sizeof(VAL);
-  for (int d = 0; d < DIM; d++) smem_size *= (tile[d] + 2 * centers[d]);
+  for (int d = 0; d < DIM; d++) smem_size *= (tile[d] + 2 * halos[d]);
   if (smem_size <= max_smem_size) {
     // Small tile case:
     launch_small_tile_kernel<VAL, DIM>(out,
@@ -1192,7 +1197,8 @@ __host__ static inline void cufft_convolution(AccessorWO<VAL, DIM> out,
                                               AccessorRO<VAL, DIM> in,
                                               const Rect<DIM>& root_rect,
                                               const Rect<DIM>& subrect,
-                                              const Rect<DIM>& filter_rect)
+                                              const Rect<DIM>& filter_rect,
+                                              const Point<DIM>& filter_centers)
 {
   int device;
   CHECK_CUDA(cudaGetDevice(&device));
@@ -1226,26 +1232,29 @@ __host__ static inline void cufft_convolution(AccessorWO<VAL, DIM> out,
   }
   unsigned extents[DIM];
   unsigned centers[DIM];
+  unsigned halos[DIM];
   for (int d = 0; d < DIM; d++) {
     assert(filter_rect.lo[d] == 0);
     extents[d] = filter_rect.hi[d] + 1;
-    centers[d] = static_cast<coord_t>(extents[d] / 2);
+    centers[d] = static_cast<unsigned>(filter_centers[d]);
+    // Size the tiles as if the filter was centered, whatever the mode is
+    halos[d] = extents[d] / 2;
   }
   Point<DIM> tile;
   for (int d = DIM - 1; d >= 0; d--) {
     // Make sure that each tile is at least double the size of the filter
     // so that we can get some savings in bandwidth needed
-    tile[d] = 2 * centers[d];
+    tile[d] = 2 * halos[d];
     if (d == (DIM - 1)) {
       // In order to maximize bandwidth, we want to make sure we're loading at
       // least 128B of contiguous memory along the last axis (row-major) of input
       const unsigned min_contig_elmts = 128 / sizeof(VAL);
-      if ((tile[d] + 2 * centers[d]) < min_contig_elmts)
-        tile[d] = min_contig_elmts - 2 * centers[d];
+      if ((tile[d] + 2 * halos[d]) < min_contig_elmts)
+        tile[d] = min_contig_elmts - 2 * halos[d];
     }
   }
   unsigned smem_size = sizeof(VAL);
-  for (int d = 0; d < DIM; d++) smem_size *= (tile[d] + 2 * centers[d]);
+  for (int d = 0; d < DIM; d++) smem_size *= (tile[d] + 2 * halos[d]);
   if (smem_size <= max_smem_size) {
     launch_small_tile_kernel<VAL, DIM>(out,
                                        filter,
@@ -1364,11 +1373,11 @@ __host__ static inline void cufft_convolution(AccessorWO<VAL, DIM> out,
       pitch *= fftsize[d];
     }
     const VAL scaling_factor = VAL(1) / pitch;
+    // Output point `p` sits at `p - input_bounds.lo + extents - 1 - centers`
+    // in the full linear convolution
     Point<DIM> buffer_offset;
     for (int d = 0; d < DIM; d++)
-      buffer_offset[d] =
-        centers[d] - (((extents[d] % 2) == 0) ? 1 : 0) +
-        ((offset_bounds.lo[d] < root_rect.lo[d]) ? (subrect.lo[d] - root_rect.lo[d]) : centers[d]);
+      buffer_offset[d] = subrect.lo[d] - input_bounds.lo[d] + extents[d] - 1 - centers[d];
     Point<DIM> output_bounds = subrect.hi - subrect.lo + one;
     pitch                    = 1;
     for (int d = DIM - 1; d >= 0; d--) {
@@ -1416,9 +1425,10 @@ struct ConvolveImplBody<VariantKind::GPU, CODE, DIM> {
                          AccessorRO<_VAL, _DIM> in,
                          const Rect<_DIM>& root_rect,
                          const Rect<_DIM>& subrect,
-                         const Rect<_DIM>& filter_rect) const
+                         const Rect<_DIM>& filter_rect,
+                         const Point<_DIM>& centers) const
   {
-    cufft_convolution<_VAL, _DIM>(out, filter, in, root_rect, subrect, filter_rect);
+    cufft_convolution<_VAL, _DIM>(out, filter, in, root_rect, subrect, filter_rect, centers);
   }
 
   template <typename _VAL, int32_t _DIM, std::enable_if_t<!UseCUFFT<_VAL, _DIM>::value>* = nullptr>
@@ -1427,9 +1437,10 @@ struct ConvolveImplBody<VariantKind::GPU, CODE, DIM> {
                          AccessorRO<_VAL, _DIM> in,
                          const Rect<_DIM>& root_rect,
                          const Rect<_DIM>& subrect,
-                         const Rect<_DIM>& filter_rect) const
+                         const Rect<_DIM>& filter_rect,
+                         const Point<_DIM>& centers) const
   {
-    direct_convolution<_VAL, _DIM>(out, filter, in, root_rect, subrect, filter_rect);
+    direct_convolution<_VAL, _DIM>(out, filter, in, root_rect, subrect, filter_rect, centers);
   }
 
   __host__ void operator()(AccessorWO<VAL, DIM> out,
@@ -1437,9 +1448,10 @@ struct ConvolveImplBody<VariantKind::GPU, CODE, DIM> {
                            AccessorRO<VAL, DIM> in,
                            const Rect<DIM>& root_rect,
                            const Rect<DIM>& subrect,
-                           const Rect<DIM>& filter_rect) const
+                           const Rect<DIM>& filter_rect,
+                           const Point<DIM>& centers) const
   {
-    dispatch(out, filter, in, root_rect, subrect, filter_rect);
+    dispatch(out, filter, in, root_rect, subrect, filter_rect, centers);
   }
 };
 
@@ -34,6 +34,7 @@ struct ConvolveArgs {
   Array filter;
   std::vector<Array> inputs;
   legate::Domain root_domain;
+  CuNumericConvolveMode mode;
 };
 
 class ConvolveTask : public CuNumericTask<ConvolveTask> {
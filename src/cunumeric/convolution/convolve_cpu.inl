@@ -0,0 +1,269 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/convolution/convolve.h"
+#include "cunumeric/fft/fft_cpu.inl"
+#include "cunumeric/pitches.h"
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+
+namespace cunumeric {
+
+using namespace legate;
+
+///////////////////////////////////////
+// FFT-based convolution implementation
+///////////////////////////////////////
+
+// Rough per-element costs used to pick between the direct and the FFT-based
+// algorithms. A real FFT of N points takes about 2.5 * N * log2(N) flops and we
+// need three of them (signal, filter and the inverse); the remaining passes over
+// the buffers (zero padding, copies and the pointwise product) are charged as a
+// constant per point. The direct algorithm takes two flops per filter tap.
+constexpr double FFT_FLOPS_PER_POINT_LOG = 3 * 2.5;
+constexpr double FFT_FLOPS_PER_POINT     = 16.0;
+constexpr double DIRECT_FLOPS_PER_TAP    = 2.0;
+
+template <typename VAL, int DIM>
+struct UsePocketFFT {
+  static constexpr bool value = 1 <= DIM && DIM <= 3 && std::is_floating_point<VAL>::value;
+};
+
+template <typename VAL, int DIM>
+struct FFTConvolutionShape {
+  FFTConvolutionShape(const Rect<DIM>& root_rect,
+                      const Rect<DIM>& subrect,
+                      const Rect<DIM>& filter_rect,
+                      const Point<DIM>& filter_centers)
+  {
+    const Point<DIM> one = Point<DIM>::ONES();
+    extents              = filter_rect.hi - filter_rect.lo + one;
+    centers              = filter_centers;
+    Rect<DIM> offset_bounds;
+    for (int d = 0; d < DIM; d++) {
+      offset_bounds.lo[d] = subrect.lo[d] - centers[d];
+      offset_bounds.hi[d] = subrect.hi[d] + extents[d] - 1 - centers[d];
+    }
+    input_bounds  = root_rect.intersection(offset_bounds);
+    signal_bounds = input_bounds.hi - input_bounds.lo + one;
+    // The linear convolution has signal + filter - 1 points per dimension, which
+    // we round up to sizes that pocketfft can transform efficiently
+    fft_volume     = 1;
+    complex_volume = 1;
+    for (int d = 0; d < DIM; d++) {
+      size_t size = signal_bounds[d] + extents[d] - 1;
+      fftsize[d]  = d == DIM - 1 ? pocketfft::detail::util::good_size_real(size)
+                                 : pocketfft::detail::util::good_size_cmplx(size);
+      complexsize[d] = d == DIM - 1 ? fftsize[d] / 2 + 1 : fftsize[d];
+      fft_volume *= fftsize[d];
+      complex_volume *= complexsize[d];
+    }
+  }
+
+  // Estimates whether the FFT-based algorithm is cheaper than the direct one
+  bool prefer_fft(const Rect<DIM>& subrect) const
+  {
+    double filter_volume = 1;
+    for (int d = 0; d < DIM; d++) filter_volume *= extents[d];
+    double direct_cost = DIRECT_FLOPS_PER_TAP * subrect.volume() * filter_volume;
+    double fft_cost    = fft_volume * (FFT_FLOPS_PER_POINT_LOG * std::log2(double(fft_volume)) +
+                                    FFT_FLOPS_PER_POINT);
+    return fft_cost < direct_cost;
+  }
+
+  Point<DIM> extents;
+  Point<DIM> centers;
+  Rect<DIM> input_bounds;
+  Point<DIM> signal_bounds;
+  Point<DIM> fftsize;
+  Point<DIM> complexsize;
+  size_t fft_volume;
+  size_t complex_volume;
+};
+
+// Zero pads the points of `rect` into a buffer holding the real data in place of
+// the complex spectrum (i.e., with the last dimension padded to 2 * (n / 2 + 1))
+// and transforms it to the frequency domain
+template <typename VAL, int DIM, typename exe_pol_t>
+void fft_convolution_forward(complex<VAL>* buffer,
+                             const AccessorRO<VAL, DIM>& acc,
+                             const Rect<DIM>& rect,
+                             const FFTConvolutionShape<VAL, DIM>& shape,
+                             const fft_cpu::FFTPlan<VAL>& plan,
+                             const exe_pol_t& exec)
+{
+  size_t complex_strides[DIM];
+  size_t real_strides[DIM];
+  fft_cpu::dense_strides<DIM>(complex_strides, shape.complexsize);
+  for (int d = 0; d < DIM; d++) real_strides[d] = d == DIM - 1 ? 1 : 2 * complex_strides[d];
+  VAL* real = reinterpret_cast<VAL*>(buffer);
+
+  thrust::fill(exec, buffer, buffer + shape.complex_volume, complex<VAL>(0, 0));
+  Pitches<DIM - 1> pitches;
+  size_t volume = pitches.flatten(rect);
+  thrust::for_each(exec,
+                   thrust::counting_iterator<size_t>(0),
+                   thrust::counting_iterator<size_t>(volume),
+                   [&](size_t idx) {
+                     auto point    = pitches.unflatten(idx, Point<DIM>::ZEROES());
+                     size_t offset = 0;
+                     for (int d = 0; d < DIM; d++) offset += point[d] * real_strides[d];
+                     real[offset] = acc[rect.lo + point];
+                   });
+
+  fft_cpu::r2c_lines<VAL, DIM>(
+    buffer, complex_strides, real, real_strides, shape.fftsize, DIM - 1, *plan.r2c_plan, exec);
+  for (int d = 0; d < DIM - 1; d++)
+    fft_cpu::c2c_lines<VAL, DIM>(buffer,
+                                 complex_strides,
+                                 buffer,
+                                 complex_strides,
+                                 shape.complexsize,
+                                 d,
+                                 *plan.c2c_plans[d],
+                                 true /*forward*/,
+                                 exec);
+}
+
+// Transforms both the input and the filter to the frequency domain, performs the
+// convolution with a pointwise multiplication, and transforms the result back
+template <typename VAL, int DIM, typename exe_pol_t>
+void fft_convolution(AccessorWO<VAL, DIM> out,
+                     AccessorRO<VAL, DIM> filter,
+                     AccessorRO<VAL, DIM> in,
+                     const Rect<DIM>& subrect,
+                     const Rect<DIM>& filter_rect,
+                     const FFTConvolutionShape<VAL, DIM>& shape,
+                     const exe_pol_t& exec)
+{
+  fft_cpu::FFTPlanKey key{std::is_same<VAL, float>::value ? CUNUMERIC_FFT_R2C : CUNUMERIC_FFT_D2Z,
+                          std::vector<int64_t>(DIM),
+                          std::vector<int64_t>(DIM),
+                          std::vector<int64_t>(DIM)};
+  for (int d = 0; d < DIM; d++) {
+    key.in_shape[d]  = shape.fftsize[d];
+    key.out_shape[d] = shape.complexsize[d];
+    key.axes[d]      = d;
+  }
+  auto plan = fft_cpu::get_fft_plan<VAL>(key);
+
+  auto signal_buffer       = create_buffer<complex<VAL>>(shape.complex_volume);
+  auto filter_buffer       = create_buffer<complex<VAL>>(shape.complex_volume);
+  complex<VAL>* signal_ptr = signal_buffer.ptr(0);
+  complex<VAL>* filter_ptr = filter_buffer.ptr(0);
+  fft_convolution_forward<VAL, DIM>(signal_ptr, in, shape.input_bounds, shape, *plan, exec);
+  fft_convolution_forward<VAL, DIM>(filter_ptr, filter, filter_rect, shape, *plan, exec);
+
+  // Perform the pointwise multiplication
+  thrust::for_each(exec,
+                   thrust::counting_iterator<size_t>(0),
+                   thrust::counting_iterator<size_t>(shape.complex_volume),
+                   [=](size_t idx) { signal_ptr[idx] *= filter_ptr[idx]; });
+
+  // Inverse FFT for the output, again in place
+  size_t complex_strides[DIM];
+  size_t real_strides[DIM];
+  fft_cpu::dense_strides<DIM>(complex_strides, shape.complexsize);
+  for (int d = 0; d < DIM; d++) real_strides[d] = d == DIM - 1 ? 1 : 2 * complex_strides[d];
+  for (int d = 0; d < DIM - 1; d++)
+    fft_cpu::c2c_lines<VAL, DIM>(signal_ptr,
+                                 complex_strides,
+                                 signal_ptr,
+                                 complex_strides,
+                                 shape.complexsize,
+                                 d,
+                                 *plan->c2c_plans[d],
+                                 false /*forward*/,
+                                 exec);
+  VAL* result = reinterpret_cast<VAL*>(signal_ptr);
+  fft_cpu::c2r_lines<VAL, DIM>(result,
+                               real_strides,
+                               signal_ptr,
+                               complex_strides,
+                               shape.fftsize,
+                               DIM - 1,
+                               *plan->r2c_plan,
+                               exec);
+
+  // Copy the result data out of the temporary buffer and scale
+  // because the inverse transform does not perform the scale for us.
+  // Output point `p` sits at `p - input_bounds.lo + extents - 1 - centers`
+  // in the full linear convolution.
+  const VAL scaling_factor = VAL(1) / shape.fft_volume;
+  Point<DIM> buffer_lo;
+  for (int d = 0; d < DIM; d++)
+    buffer_lo[d] =
+      subrect.lo[d] - shape.input_bounds.lo[d] + shape.extents[d] - 1 - shape.centers[d];
+  Pitches<DIM - 1> pitches;
+  size_t volume = pitches.flatten(subrect);
+  thrust::for_each(exec,
+                   thrust::counting_iterator<size_t>(0),
+                   thrust::counting_iterator<size_t>(volume),
+                   [&](size_t idx) {
+                     auto point    = pitches.unflatten(idx, Point<DIM>::ZEROES());
+                     size_t offset = 0;
+                     for (int d = 0; d < DIM; d++)
+                       offset += (buffer_lo[d] + point[d]) * real_strides[d];
+                     out[subrect.lo + point] = scaling_factor * result[offset];
+                   });
+}
+
+// Runs the FFT-based convolution and returns true if the cost model prefers it
+// over the direct one; otherwise returns false and leaves the output untouched
+template <typename VAL,
+          int DIM,
+          typename exe_pol_t,
+          std::enable_if_t<UsePocketFFT<VAL, DIM>::value>* = nullptr>
+bool try_fft_convolution(AccessorWO<VAL, DIM> out,
+                         AccessorRO<VAL, DIM> filter,
+                         AccessorRO<VAL, DIM> in,
+                         const Rect<DIM>& root_rect,
+                         const Rect<DIM>& subrect,
+                         const Rect<DIM>& filter_rect,
+                         const Point<DIM>& centers,
+                         const exe_pol_t& exec)
+{
+  for (int d = 0; d < DIM; d++) assert(filter_rect.lo[d] == 0);
+  FFTConvolutionShape<VAL, DIM> shape(root_rect, subrect, filter_rect, centers);
+  if (!shape.prefer_fft(subrect)) return false;
+  fft_convolution<VAL, DIM>(out, filter, in, subrect, filter_rect, shape, exec);
+  return true;
+}
+
+template <typename VAL,
+          int DIM,
+          typename exe_pol_t,
+          std::enable_if_t<!UsePocketFFT<VAL, DIM>::value>* = nullptr>
+bool try_fft_convolution(AccessorWO<VAL, DIM> out,
+                         AccessorRO<VAL, DIM> filter,
+                         AccessorRO<VAL, DIM> in,
+                         const Rect<DIM>& root_rect,
+                         const Rect<DIM>& subrect,
+                         const Rect<DIM>& filter_rect,
+                         const Point<DIM>& centers,
+                         const exe_pol_t& exec)
+{
+  return false;
+}
+
+}  // namespace cunumeric
@@ -17,8 +17,10 @@
 #include "cunumeric/divmod.h"
 #include "cunumeric/convolution/convolve.h"
 #include "cunumeric/convolution/convolve_template.inl"
+#include "cunumeric/convolution/convolve_cpu.inl"
 
 #include <omp.h>
+#include <thrust/system/omp/execution_policy.h>
 
 namespace cunumeric {
 
@@ -33,13 +35,17 @@ struct ConvolveImplBody<VariantKind::OMP, CODE, DIM> {
                   AccessorRO<VAL, DIM> in,
                   const Rect<DIM>& root_rect,
                   const Rect<DIM>& subrect,
-                  const Rect<DIM>& filter_rect) const
+                  const Rect<DIM>& filter_rect,
+                  const Point<DIM>& centers) const
   {
+    // Large filters are cheaper to apply in the frequency domain
+    if (try_fft_convolution<VAL, DIM>(
+          out, filter, in, root_rect, subrect, filter_rect, centers, thrust::omp::par))
+      return;
+
     const Point<DIM> zero = Point<DIM>::ZEROES();
     const Point<DIM> one  = Point<DIM>::ONES();
     Point<DIM> extents    = filter_rect.hi - filter_rect.lo + one;
-    Point<DIM> centers;
-    for (int d = 0; d < DIM; d++) centers[d] = extents[d] / 2;
 
     // Compute the tiles for the L2 cache
     Point<DIM> l2_output_tile, l2_filter_tile;
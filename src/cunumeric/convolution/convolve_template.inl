@@ -29,6 +29,33 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE, int DIM>
 struct ConvolveImplBody;
 
+// Output point `p` reads the input points from `p - centers` to
+// `p - centers + extents - 1`, so the mode decides where the outputs start
+// in the full linear convolution
+template <int DIM>
+static Point<DIM> convolve_centers(const Rect<DIM>& filter_rect, CuNumericConvolveMode mode)
+{
+  Point<DIM> centers;
+  for (int d = 0; d < DIM; d++) {
+    coord_t extent = filter_rect.hi[d] - filter_rect.lo[d] + 1;
+    switch (mode) {
+      case CUNUMERIC_CONVOLVE_FULL: {
+        centers[d] = extent - 1;
+        break;
+      }
+      case CUNUMERIC_CONVOLVE_VALID: {
+        centers[d] = 0;
+        break;
+      }
+      case CUNUMERIC_CONVOLVE_SAME: {
+        centers[d] = extent / 2;
+        break;
+      }
+    }
+  }
+  return centers;
+}
+
 template <VariantKind KIND>
 struct ConvolveImpl {
   template <Type::Code CODE, int DIM, std::enable_if_t<(DIM <= 3)>* = nullptr>
@@ -40,7 +67,9 @@ struct ConvolveImpl {
 
     if (subrect.empty()) return;
 
-    auto input_subrect = subrect;
+    // The output is not aligned with the input unless the mode is 'same',
+    // so the input bounds come from the images alone
+    auto input_subrect = args.inputs[0].shape<DIM>();
     for (auto idx = 1; idx < args.inputs.size(); ++idx) {
       auto image_subrect = args.inputs[idx].shape<DIM>();
       input_subrect      = input_subrect.union_bbox(image_subrect);
@@ -52,7 +81,9 @@ struct ConvolveImpl {
     auto input = args.inputs[0].read_accessor<VAL, DIM>(input_subrect);
 
     Rect<DIM> root_rect(args.root_domain);
-    ConvolveImplBody<KIND, CODE, DIM>()(out, filter, input, root_rect, subrect, filter_rect);
+    auto centers = convolve_centers<DIM>(filter_rect, args.mode);
+    ConvolveImplBody<KIND, CODE, DIM>()(
+      out, filter, input, root_rect, subrect, filter_rect, centers);
   }
 
   template <Type::Code CODE, int DIM, std::enable_if_t<!(DIM <= 3)>* = nullptr>
@@ -80,6 +111,7 @@ static void convolve_template(TaskContext& context)
     args.root_domain.rect_data[dim]             = 0;
     args.root_domain.rect_data[dim + shape.dim] = shape[dim] - 1;
   }
+  args.mode = static_cast<CuNumericConvolveMode>(context.scalars()[1].value<int32_t>());
 
   double_dispatch(args.out.dim(), args.out.code(), ConvolveImpl<KIND>{}, args);
 }
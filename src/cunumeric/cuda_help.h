@@ -21,6 +21,7 @@
 #include "core/cuda/stream_pool.h"
 #include "cunumeric/arg.h"
 #include "cunumeric/device_scalar_reduction_buffer.h"
+#include "cunumeric/welford.h"
 #include <cublas_v2.h>
 #include <cusolverDn.h>
 #include <cuda_runtime.h>
@@ -252,6 +253,11 @@ struct HasNativeShuffle<Argval<T>> {
   static constexpr bool value = false;
 };
 
+template <typename T>
+struct HasNativeShuffle<WelfordState<T>> {
+  static constexpr bool value = false;
+};
+
 template <typename T, typename REDUCTION>
 __device__ __forceinline__ void reduce_output(DeviceScalarReductionBuffer<REDUCTION> result,
                                               T value)
@@ -46,6 +46,7 @@ enum CuNumericOpCode {
   CUNUMERIC_FFT,
   CUNUMERIC_FILL,
   CUNUMERIC_FLIP,
+  CUNUMERIC_FUSED_ELEMENTWISE,
   CUNUMERIC_GEMM,
   CUNUMERIC_HISTOGRAM,
   CUNUMERIC_LOAD_CUDALIBS,
@@ -53,6 +54,7 @@ enum CuNumericOpCode {
   CUNUMERIC_MATVECMUL,
   CUNUMERIC_NONZERO,
   CUNUMERIC_PACKBITS,
+  CUNUMERIC_PARTITION,
   CUNUMERIC_POTRF,
   CUNUMERIC_PUTMASK,
   CUNUMERIC_RAND,
@@ -104,6 +106,7 @@ enum CuNumericUnaryOpCode {
   CUNUMERIC_UOP_FLOOR,
   CUNUMERIC_UOP_FREXP,
   CUNUMERIC_UOP_GETARG,
+  CUNUMERIC_UOP_GETVAR,
   CUNUMERIC_UOP_IMAG,
   CUNUMERIC_UOP_INVERT,
   CUNUMERIC_UOP_ISFINITE,
@@ -230,6 +233,19 @@ enum CuNumericScanCode {
   CUNUMERIC_SCAN_SUM,
 };
 
+// Match these to ScanLocalMode in config.py
+enum CuNumericScanLocalMode {
+  CUNUMERIC_SCAN_LOCAL_FULL     = 0,
+  CUNUMERIC_SCAN_LOCAL_TOTALS   = 1,
+  CUNUMERIC_SCAN_LOCAL_PREFIXED = 2,
+};
+
+// Match these to FusedOpKind in config.py
+enum CuNumericFusedOpKind {
+  CUNUMERIC_FUSED_UNARY  = 0,
+  CUNUMERIC_FUSED_BINARY = 1,
+};
+
 // Match these to ConvertCode in config.py
 // Also, sort these alphabetically for easy lookup later
 enum CuNumericConvertCode {
@@ -329,6 +345,13 @@ enum CuNumericFFTDirection { CUNUMERIC_FFT_FORWARD = -1, CUNUMERIC_FFT_INVERSE =
 // Match these to Bitorder in config.py
 enum CuNumericBitorder { CUNUMERIC_BITORDER_BIG = 0, CUNUMERIC_BITORDER_LITTLE = 1 };
 
+// Match these to ConvolveModeCode in config.py
+enum CuNumericConvolveMode {
+  CUNUMERIC_CONVOLVE_FULL  = 0,
+  CUNUMERIC_CONVOLVE_VALID = 1,
+  CUNUMERIC_CONVOLVE_SAME  = 2,
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -336,6 +359,7 @@ extern "C" {
 void cunumeric_perform_registration();
 bool cunumeric_has_curand();
 void cunumeric_register_reduction_op(int32_t type_uid, int32_t elem_type_code);
+void cunumeric_register_welford_op(int32_t type_uid, int32_t elem_type_code);
 
 #ifdef __cplusplus
 }
@@ -18,8 +18,26 @@
 
 #include "cunumeric/cunumeric.h"
 
+#include <algorithm>
+#include <type_traits>
+
 namespace cunumeric {
 
+// Some reductions are settled before every point is visited, like ANY once a true value
+// has been seen. Their kernels can set `static constexpr bool EARLY_EXIT = true` and
+// provide `bool decided(const LHS& lhs) const`, which returns whether a partial result can
+// no longer change. The host policies then visit the points in blocks of this many points
+// and stop at the first block after which a partial result is decided, which keeps the
+// check out of the inner loop.
+constexpr size_t EARLY_EXIT_BLOCK_SIZE = 4096;
+
+template <class Kernel, class = void>
+struct has_early_exit : std::false_type {};
+
+template <class Kernel>
+struct has_early_exit<Kernel, std::void_t<decltype(Kernel::EARLY_EXIT)>>
+  : std::bool_constant<Kernel::EARLY_EXIT> {};
+
 template <VariantKind KIND, class LG_OP, class Tag = void>
 struct ScalarReductionPolicy {
   // No C++-20 yet. This is just here to illustrate the expected concept
@@ -42,7 +60,15 @@ struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, Tag> {
   void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
   {
     auto result = identity;
-    for (size_t idx = 0; idx < volume; ++idx) { kernel(result, idx, identity, Tag{}); }
+    if constexpr (has_early_exit<std::decay_t<Kernel>>::value) {
+      for (size_t start = 0; start < volume && !kernel.decided(result);
+           start += EARLY_EXIT_BLOCK_SIZE) {
+        const size_t stop = std::min(start + EARLY_EXIT_BLOCK_SIZE, volume);
+        for (size_t idx = start; idx < stop; ++idx) { kernel(result, idx, identity, Tag{}); }
+      }
+    } else {
+      for (size_t idx = 0; idx < volume; ++idx) { kernel(result, idx, identity, Tag{}); }
+    }
     out.reduce(0, result);
   }
 };
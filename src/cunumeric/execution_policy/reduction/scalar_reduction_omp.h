@@ -19,6 +19,7 @@
 #include "cunumeric/execution_policy/reduction/scalar_reduction.h"
 #include "cunumeric/omp_help.h"
 
+#include <atomic>
 #include <omp.h>
 
 namespace cunumeric {
@@ -31,11 +32,33 @@ struct ScalarReductionPolicy<VariantKind::OMP, LG_OP, Tag> {
     const auto max_threads = omp_get_max_threads();
     ThreadLocalStorage<LHS> locals(max_threads);
     for (auto idx = 0; idx < max_threads; ++idx) locals[idx] = identity;
+    if constexpr (has_early_exit<std::decay_t<Kernel>>::value) {
+      // Each thread takes a contiguous chunk and polls between blocks whether any thread has
+      // decided the result already. The partial results of threads that stop early are still
+      // folded into the output, which the decided one dominates.
+      std::atomic<bool> decided{false};
 #pragma omp parallel
-    {
-      const int tid = omp_get_thread_num();
+      {
+        const int tid      = omp_get_thread_num();
+        auto [start, stop] = thread_range(volume);
+        auto& local        = locals[tid];
+        for (size_t block = start; block < stop; block += EARLY_EXIT_BLOCK_SIZE) {
+          if (decided.load(std::memory_order_relaxed)) break;
+          const size_t block_stop = std::min(block + EARLY_EXIT_BLOCK_SIZE, stop);
+          for (size_t idx = block; idx < block_stop; ++idx) kernel(local, idx, identity, Tag{});
+          if (kernel.decided(local)) {
+            decided.store(true, std::memory_order_relaxed);
+            break;
+          }
+        }
+      }
+    } else {
+#pragma omp parallel
+      {
+        const int tid = omp_get_thread_num();
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) { kernel(locals[tid], idx, identity, Tag{}); }
+        for (size_t idx = 0; idx < volume; ++idx) { kernel(locals[tid], idx, identity, Tag{}); }
+      }
     }
     for (auto idx = 0; idx < max_threads; ++idx) out.reduce(0, locals[idx]);
   }
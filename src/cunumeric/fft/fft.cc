@@ -0,0 +1,53 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/fft/fft.h"
+#include "cunumeric/fft/fft_template.inl"
+#include "cunumeric/fft/fft_cpu.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <CuNumericFFTType FFT_TYPE, Type::Code CODE_OUT, Type::Code CODE_IN, int32_t DIM>
+struct FFTImplBody<VariantKind::CPU, FFT_TYPE, CODE_OUT, CODE_IN, DIM> {
+  using INPUT_TYPE  = legate_type_of<CODE_IN>;
+  using OUTPUT_TYPE = legate_type_of<CODE_OUT>;
+
+  void operator()(AccessorWO<OUTPUT_TYPE, DIM> out,
+                  AccessorRO<INPUT_TYPE, DIM> in,
+                  const Rect<DIM>& out_rect,
+                  const Rect<DIM>& in_rect,
+                  std::vector<int64_t>& axes,
+                  CuNumericFFTDirection direction,
+                  bool operate_over_axes) const
+  {
+    FFTImplBodyCpu<FFT_TYPE, CODE_OUT, CODE_IN, DIM>()(
+      out, in, out_rect, in_rect, axes, direction, thrust::host);
+  }
+};
+
+/*static*/ void FFTTask::cpu_variant(TaskContext& context)
+{
+  fft_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { FFTTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
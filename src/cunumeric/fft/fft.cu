@@ -365,9 +365,4 @@ struct FFTImplBody<VariantKind::GPU, FFT_TYPE, CODE_OUT, CODE_IN, DIM> {
   fft_template<VariantKind::GPU>(context);
 };
 
-namespace  // unnamed
-{
-static void __attribute__((constructor)) register_tasks(void) { FFTTask::register_variants(); }
-}  // namespace
-
 }  // namespace cunumeric
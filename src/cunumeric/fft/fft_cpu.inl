@@ -0,0 +1,414 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/fft/fft.h"
+#include "cunumeric/fft/fft_util.h"
+
+#include <thrust/detail/config.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// Threading is done by the task variants themselves
+#define POCKETFFT_NO_MULTITHREADING
+#include "pocketfft_hdronly.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+namespace fft_cpu {
+
+template <typename T>
+using c2c_plan_t = pocketfft::detail::pocketfft_c<T>;
+template <typename T>
+using r2c_plan_t = pocketfft::detail::pocketfft_r<T>;
+template <typename T>
+using cmplx_t = pocketfft::detail::cmplx<T>;
+
+// Target amount of elements processed by a single chunk of lines
+constexpr size_t ELEMENTS_PER_CHUNK = 1 << 16;
+
+struct FFTPlanKey {
+  CuNumericFFTType type;
+  std::vector<int64_t> in_shape;
+  std::vector<int64_t> out_shape;
+  std::vector<int64_t> axes;
+
+  bool operator==(const FFTPlanKey& other) const
+  {
+    return type == other.type && in_shape == other.in_shape && out_shape == other.out_shape &&
+           axes == other.axes;
+  }
+};
+
+// 1D plans for all passes of a (possibly multi-axis) transform. For R2C and C2R, the real
+// transform runs along the last of the axes and the complex plans cover the remaining ones.
+template <typename T>
+struct FFTPlan {
+  std::vector<std::shared_ptr<c2c_plan_t<T>>> c2c_plans;
+  std::shared_ptr<r2c_plan_t<T>> r2c_plan{nullptr};
+};
+
+template <typename T>
+class FFTPlanCache {
+ private:
+  // Maximum number of plans to keep per precision
+  static constexpr size_t MAX_PLANS = 16;
+
+ public:
+  std::shared_ptr<const FFTPlan<T>> get_plan(const FFTPlanKey& key)
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    auto finder =
+      std::find_if(cache_.begin(), cache_.end(), [&](auto& entry) { return entry.first == key; });
+    if (finder != cache_.end()) {
+      // Move the hit to the front of the LRU list
+      cache_.splice(cache_.begin(), cache_, finder);
+      return cache_.front().second;
+    }
+    if (cache_.size() == MAX_PLANS) cache_.pop_back();
+    cache_.emplace_front(key, create_plan(key));
+    return cache_.front().second;
+  }
+
+ private:
+  static std::shared_ptr<const FFTPlan<T>> create_plan(const FFTPlanKey& key)
+  {
+    auto plan    = std::make_shared<FFTPlan<T>>();
+    bool is_c2c  = key.type == CUNUMERIC_FFT_C2C || key.type == CUNUMERIC_FFT_Z2Z;
+    bool is_r2c  = key.type == CUNUMERIC_FFT_R2C || key.type == CUNUMERIC_FFT_D2Z;
+    auto c2c_end = key.axes.end() - (is_c2c ? 0 : 1);
+    // C2C passes run on the complex side, which is the output for R2C and the input otherwise
+    auto& c2c_shape = is_r2c ? key.out_shape : key.in_shape;
+    // Axes of the same extent share their 1D plan
+    std::map<size_t, std::shared_ptr<c2c_plan_t<T>>> by_length;
+    for (auto it = key.axes.begin(); it != c2c_end; ++it) {
+      size_t length = c2c_shape[*it];
+      auto& c2c     = by_length[length];
+      if (nullptr == c2c) c2c = std::make_shared<c2c_plan_t<T>>(length);
+      plan->c2c_plans.push_back(c2c);
+    }
+    if (!is_c2c) {
+      auto& real_shape = is_r2c ? key.in_shape : key.out_shape;
+      plan->r2c_plan   = std::make_shared<r2c_plan_t<T>>(real_shape[key.axes.back()]);
+    }
+    return plan;
+  }
+
+ private:
+  std::mutex lock_;
+  std::list<std::pair<FFTPlanKey, std::shared_ptr<const FFTPlan<T>>>> cache_;
+};
+
+template <typename T>
+std::shared_ptr<const FFTPlan<T>> get_fft_plan(const FFTPlanKey& key)
+{
+  static FFTPlanCache<T> cache;
+  return cache.get_plan(key);
+}
+
+// Maps the index of a 1D line along `axis` to the offset of its first element
+template <int32_t DIM>
+struct FFTLines {
+  FFTLines(const Point<DIM>& extents, int64_t axis) : extents(extents), axis(axis)
+  {
+    num_lines = 1;
+    for (int32_t d = 0; d < DIM; ++d)
+      if (d != axis) num_lines *= extents[d];
+  }
+
+  size_t offset(size_t line, const size_t strides[DIM]) const
+  {
+    size_t offset = 0;
+    for (int32_t d = DIM - 1; d >= 0; --d) {
+      if (d == axis) continue;
+      offset += (line % extents[d]) * strides[d];
+      line /= extents[d];
+    }
+    return offset;
+  }
+
+  Point<DIM> extents;
+  int64_t axis;
+  size_t num_lines;
+};
+
+// Runs `kernel(lo, hi)` over chunks of lines so that per-chunk scratch space is amortized
+template <typename Kernel, typename exe_pol_t>
+void for_each_chunk(size_t num_lines, size_t n, Kernel&& kernel, const exe_pol_t& exec)
+{
+  const size_t lines_per_chunk = std::max<size_t>(1, ELEMENTS_PER_CHUNK / std::max<size_t>(1, n));
+  const size_t num_chunks      = (num_lines + lines_per_chunk - 1) / lines_per_chunk;
+  thrust::for_each(exec,
+                   thrust::counting_iterator<size_t>(0),
+                   thrust::counting_iterator<size_t>(num_chunks),
+                   [&](size_t chunk) {
+                     size_t lo = chunk * lines_per_chunk;
+                     kernel(lo, std::min(lo + lines_per_chunk, num_lines));
+                   });
+}
+
+// Batched complex-to-complex transforms of all lines along `axis` (in and out may alias)
+template <typename T, int32_t DIM, typename exe_pol_t>
+void c2c_lines(complex<T>* out,
+               const size_t out_strides[DIM],
+               const complex<T>* in,
+               const size_t in_strides[DIM],
+               const Point<DIM>& extents,
+               int64_t axis,
+               const c2c_plan_t<T>& plan,
+               bool forward,
+               const exe_pol_t& exec)
+{
+  FFTLines<DIM> lines(extents, axis);
+  const size_t n       = extents[axis];
+  const size_t istride = in_strides[axis];
+  const size_t ostride = out_strides[axis];
+  for_each_chunk(
+    lines.num_lines,
+    n,
+    [&](size_t lo, size_t hi) {
+      std::vector<cmplx_t<T>> scratch(ostride == 1 ? 0 : n);
+      for (size_t line = lo; line < hi; ++line) {
+        auto in_line  = in + lines.offset(line, in_strides);
+        auto out_line = out + lines.offset(line, out_strides);
+        if (ostride == 1) {
+          // Transform in place in the output
+          if (in_line != out_line)
+            for (size_t i = 0; i < n; ++i) out_line[i] = in_line[i * istride];
+          plan.exec(reinterpret_cast<cmplx_t<T>*>(out_line), T{1}, forward);
+        } else {
+          auto buf = reinterpret_cast<complex<T>*>(scratch.data());
+          for (size_t i = 0; i < n; ++i) buf[i] = in_line[i * istride];
+          plan.exec(scratch.data(), T{1}, forward);
+          for (size_t i = 0; i < n; ++i) out_line[i * ostride] = buf[i];
+        }
+      }
+    },
+    exec);
+}
+
+// Batched forward real-to-complex transforms of all lines along `axis`.
+// `extents` are those of the real input; the output keeps the first n / 2 + 1 coefficients.
+template <typename T, int32_t DIM, typename exe_pol_t>
+void r2c_lines(complex<T>* out,
+               const size_t out_strides[DIM],
+               const T* in,
+               const size_t in_strides[DIM],
+               const Point<DIM>& extents,
+               int64_t axis,
+               const r2c_plan_t<T>& plan,
+               const exe_pol_t& exec)
+{
+  FFTLines<DIM> lines(extents, axis);
+  const size_t n       = extents[axis];
+  const size_t istride = in_strides[axis];
+  const size_t ostride = out_strides[axis];
+  for_each_chunk(
+    lines.num_lines,
+    n,
+    [&](size_t lo, size_t hi) {
+      std::vector<T> scratch(n);
+      for (size_t line = lo; line < hi; ++line) {
+        auto in_line  = in + lines.offset(line, in_strides);
+        auto out_line = out + lines.offset(line, out_strides);
+        for (size_t i = 0; i < n; ++i) scratch[i] = in_line[i * istride];
+        plan.exec(scratch.data(), T{1}, true /*r2hc*/);
+        // Unpack the halfcomplex result [r0, r1, i1, r2, i2, ...]
+        out_line[0] = complex<T>(scratch[0], T{0});
+        size_t i = 1, k = 1;
+        for (; i + 1 < n; i += 2, ++k)
+          out_line[k * ostride] = complex<T>(scratch[i], scratch[i + 1]);
+        if (i < n) out_line[k * ostride] = complex<T>(scratch[i], T{0});
+      }
+    },
+    exec);
+}
+
+// Batched inverse complex-to-real transforms of all lines along `axis`.
+// `extents` are those of the real output; only the first n / 2 + 1 input coefficients are read.
+template <typename T, int32_t DIM, typename exe_pol_t>
+void c2r_lines(T* out,
+               const size_t out_strides[DIM],
+               const complex<T>* in,
+               const size_t in_strides[DIM],
+               const Point<DIM>& extents,
+               int64_t axis,
+               const r2c_plan_t<T>& plan,
+               const exe_pol_t& exec)
+{
+  FFTLines<DIM> lines(extents, axis);
+  const size_t n       = extents[axis];
+  const size_t istride = in_strides[axis];
+  const size_t ostride = out_strides[axis];
+  for_each_chunk(
+    lines.num_lines,
+    n,
+    [&](size_t lo, size_t hi) {
+      std::vector<T> scratch(n);
+      for (size_t line = lo; line < hi; ++line) {
+        auto in_line  = in + lines.offset(line, in_strides);
+        auto out_line = out + lines.offset(line, out_strides);
+        // Pack the input into halfcomplex order
+        scratch[0] = in_line[0].real();
+        size_t i = 1, k = 1;
+        for (; i + 1 < n; i += 2, ++k) {
+          scratch[i]     = in_line[k * istride].real();
+          scratch[i + 1] = in_line[k * istride].imag();
+        }
+        if (i < n) scratch[i] = in_line[k * istride].real();
+        plan.exec(scratch.data(), T{1}, false /*r2hc*/);
+        for (size_t j = 0; j < n; ++j) out_line[j * ostride] = scratch[j];
+      }
+    },
+    exec);
+}
+
+template <int32_t DIM>
+void dense_strides(size_t strides[DIM], const Point<DIM>& extents)
+{
+  size_t stride = 1;
+  for (int32_t d = DIM - 1; d >= 0; --d) {
+    strides[d] = stride;
+    stride *= extents[d];
+  }
+}
+
+template <typename T>
+struct fft_precision {
+  using type = T;
+};
+
+template <typename T>
+struct fft_precision<complex<T>> {
+  using type = T;
+};
+
+}  // namespace fft_cpu
+
+// Host FFT: every transform is computed as a sequence of batched 1D passes over the axes.
+// C2C - all axes one after another, the first pass reading straight from the input
+// R2C - R2C along the LAST axis into the output, follow up by in-place C2C on remaining axes
+// C2R - C2C on all but the last axis into a temporary, finish with C2R along the LAST axis
+template <CuNumericFFTType FFT_TYPE, Type::Code CODE_OUT, Type::Code CODE_IN, int32_t DIM>
+struct FFTImplBodyCpu {
+  using INPUT_TYPE  = legate_type_of<CODE_IN>;
+  using OUTPUT_TYPE = legate_type_of<CODE_OUT>;
+  using T           = typename fft_cpu::fft_precision<INPUT_TYPE>::type;
+
+  static constexpr bool is_c2c = FFT_TYPE == CUNUMERIC_FFT_C2C || FFT_TYPE == CUNUMERIC_FFT_Z2Z;
+  static constexpr bool is_r2c = FFT_TYPE == CUNUMERIC_FFT_R2C || FFT_TYPE == CUNUMERIC_FFT_D2Z;
+
+  template <typename exe_pol_t>
+  void operator()(AccessorWO<OUTPUT_TYPE, DIM> out,
+                  AccessorRO<INPUT_TYPE, DIM> in,
+                  const Rect<DIM>& out_rect,
+                  const Rect<DIM>& in_rect,
+                  std::vector<int64_t>& axes,
+                  CuNumericFFTDirection direction,
+                  const exe_pol_t& exec) const
+  {
+    assert(out.accessor.is_dense_row_major(out_rect));
+    assert(!axes.empty());
+
+    const Point<DIM> one    = Point<DIM>::ONES();
+    Point<DIM> fft_size_in  = in_rect.hi - in_rect.lo + one;
+    Point<DIM> fft_size_out = out_rect.hi - out_rect.lo + one;
+    const bool forward      = direction == CUNUMERIC_FFT_FORWARD;
+
+    // get plan from cache
+    fft_cpu::FFTPlanKey key{FFT_TYPE, std::vector<int64_t>(DIM), std::vector<int64_t>(DIM), axes};
+    for (int32_t d = 0; d < DIM; ++d) {
+      key.in_shape[d]  = fft_size_in[d];
+      key.out_shape[d] = fft_size_out[d];
+    }
+    auto plan = fft_cpu::get_fft_plan<T>(key);
+
+    size_t in_strides[DIM];
+    size_t out_strides[DIM];
+    const INPUT_TYPE* in_ptr = in.ptr(in_rect, in_strides);
+    OUTPUT_TYPE* out_ptr     = out.ptr(out_rect, out_strides);
+
+    if constexpr (is_c2c) {
+      // The first pass reads the input and all others run in place on the output
+      const INPUT_TYPE* src     = in_ptr;
+      const size_t* src_strides = in_strides;
+      for (size_t idx = 0; idx < axes.size(); ++idx) {
+        fft_cpu::c2c_lines<T, DIM>(out_ptr,
+                                   out_strides,
+                                   src,
+                                   src_strides,
+                                   fft_size_out,
+                                   axes[idx],
+                                   *plan->c2c_plans[idx],
+                                   forward,
+                                   exec);
+        src         = out_ptr;
+        src_strides = out_strides;
+      }
+    } else if constexpr (is_r2c) {
+      fft_cpu::r2c_lines<T, DIM>(
+        out_ptr, out_strides, in_ptr, in_strides, fft_size_in, axes.back(), *plan->r2c_plan, exec);
+      for (size_t idx = 0; idx + 1 < axes.size(); ++idx)
+        fft_cpu::c2c_lines<T, DIM>(out_ptr,
+                                   out_strides,
+                                   out_ptr,
+                                   out_strides,
+                                   fft_size_out,
+                                   axes[idx],
+                                   *plan->c2c_plans[idx],
+                                   forward,
+                                   exec);
+    } else {
+      const INPUT_TYPE* src     = in_ptr;
+      const size_t* src_strides = in_strides;
+      Buffer<INPUT_TYPE> temp;
+      size_t temp_strides[DIM];
+      if (axes.size() > 1) {
+        // The input must not be modified, so the C2C passes go to a temporary
+        temp = create_buffer<INPUT_TYPE>(in_rect.volume());
+        fft_cpu::dense_strides<DIM>(temp_strides, fft_size_in);
+        for (size_t idx = 0; idx + 1 < axes.size(); ++idx) {
+          fft_cpu::c2c_lines<T, DIM>(temp.ptr(0),
+                                     temp_strides,
+                                     src,
+                                     src_strides,
+                                     fft_size_in,
+                                     axes[idx],
+                                     *plan->c2c_plans[idx],
+                                     forward,
+                                     exec);
+          src         = temp.ptr(0);
+          src_strides = temp_strides;
+        }
+      }
+      fft_cpu::c2r_lines<T, DIM>(
+        out_ptr, out_strides, src, src_strides, fft_size_out, axes.back(), *plan->r2c_plan, exec);
+    }
+  }
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,55 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/fused/fused_elementwise.h"
+#include "cunumeric/fused/fused_elementwise_template.inl"
+#include "cunumeric/fused/fused_elementwise_cpu.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct FusedElementwiseImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const FusedProgram& program,
+                  const FusedOps<CODE>& ops,
+                  AccessorWO<VAL, DIM> out,
+                  const FusedInputs<VAL, DIM>& inputs,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    FusedTileEvaluator<CODE> evaluator(program, ops);
+    evaluator.evaluate(out, inputs, pitches, rect, dense, 0, rect.volume());
+  }
+};
+
+/*static*/ void FusedElementwiseTask::cpu_variant(TaskContext& context)
+{
+  fused_elementwise_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  FusedElementwiseTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
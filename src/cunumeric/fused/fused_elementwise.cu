@@ -0,0 +1,120 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/fused/fused_elementwise.h"
+#include "cunumeric/fused/fused_elementwise_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+// Pointers to the inputs of a dense launch, in an array that the kernel can take by value
+template <typename VAL>
+struct FusedPointers {
+  const VAL* ptrs[FUSED_MAX_INPUTS];
+};
+
+// Interprets the program on the registers of a single point, whose first entries hold the
+// values of the inputs
+template <Type::Code CODE>
+static __device__ inline legate_type_of<CODE> evaluate_point(const FusedProgram& program,
+                                                             const FusedOps<CODE>& ops,
+                                                             legate_type_of<CODE>* registers)
+{
+  for (int32_t idx = 0; idx < program.num_instructions; ++idx) {
+    auto& inst = program.instructions[idx];
+    auto rhs1  = registers[inst.src1];
+    if (inst.kind == FusedOpKind::UNARY)
+      registers[program.num_inputs + idx] =
+        ops.visit_unary(inst.op_code, [&](const auto& func) { return func(rhs1); });
+    else {
+      auto rhs2 = registers[inst.src2];
+      registers[program.num_inputs + idx] =
+        ops.visit_binary(inst.op_code, [&](const auto& func) { return func(rhs1, rhs2); });
+    }
+  }
+  return registers[program.result()];
+}
+
+template <Type::Code CODE, typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  dense_kernel(size_t volume,
+               FusedProgram program,
+               FusedOps<CODE> ops,
+               VAL* out,
+               FusedPointers<VAL> inputs)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  VAL registers[FUSED_MAX_REGISTERS];
+  for (int32_t in = 0; in < program.num_inputs; ++in) registers[in] = inputs.ptrs[in][idx];
+  out[idx] = evaluate_point<CODE>(program, ops, registers);
+}
+
+template <Type::Code CODE, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  generic_kernel(size_t volume,
+                 FusedProgram program,
+                 FusedOps<CODE> ops,
+                 AccessorWO<VAL, DIM> out,
+                 FusedInputs<VAL, DIM> inputs,
+                 Pitches<DIM - 1> pitches,
+                 Rect<DIM> rect)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  auto point = pitches.unflatten(idx, rect.lo);
+  VAL registers[FUSED_MAX_REGISTERS];
+  for (int32_t in = 0; in < program.num_inputs; ++in)
+    registers[in] = inputs.accessors[in][point];
+  out[point] = evaluate_point<CODE>(program, ops, registers);
+}
+
+template <Type::Code CODE, int DIM>
+struct FusedElementwiseImplBody<VariantKind::GPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(const FusedProgram& program,
+                  const FusedOps<CODE>& ops,
+                  AccessorWO<VAL, DIM> out,
+                  const FusedInputs<VAL, DIM>& inputs,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    const size_t volume = rect.volume();
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    auto stream         = get_cached_stream();
+    if (dense) {
+      FusedPointers<VAL> inptrs;
+      for (int32_t idx = 0; idx < program.num_inputs; ++idx)
+        inptrs.ptrs[idx] = inputs.accessors[idx].ptr(rect);
+      dense_kernel<CODE><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        volume, program, ops, out.ptr(rect), inptrs);
+    } else {
+      generic_kernel<CODE><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+        volume, program, ops, out, inputs, pitches, rect);
+    }
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void FusedElementwiseTask::gpu_variant(TaskContext& context)
+{
+  fused_elementwise_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
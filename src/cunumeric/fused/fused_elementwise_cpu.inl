@@ -0,0 +1,138 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/fused/fused_elementwise.h"
+#include "cunumeric/nd_iterator.h"
+#include "cunumeric/pitches.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// Evaluates a fused program on the host one tile of points at a time. Each instruction runs
+// over the whole tile before the next one does, so the inner loops are as simple as those of
+// the unfused tasks, while the intermediate values stay in the cache instead of making a
+// round trip through memory. Each thread needs its own evaluator.
+template <Type::Code CODE>
+class FusedTileEvaluator {
+ public:
+  using VAL                         = legate_type_of<CODE>;
+  static constexpr size_t TILE_SIZE = 256;
+
+ public:
+  FusedTileEvaluator(const FusedProgram& program, const FusedOps<CODE>& ops)
+    : program_(program), ops_(ops), buffer_(FUSED_MAX_REGISTERS * TILE_SIZE)
+  {
+  }
+
+ public:
+  // Evaluates the points in [start, stop) of the row-major linearization of `rect`
+  template <int DIM>
+  void evaluate(AccessorWO<VAL, DIM> out,
+                const FusedInputs<VAL, DIM>& inputs,
+                const Pitches<DIM - 1>& pitches,
+                const Rect<DIM>& rect,
+                bool dense,
+                size_t start,
+                size_t stop)
+  {
+    const VAL* inptrs[FUSED_MAX_INPUTS];
+    size_t in_strides[FUSED_MAX_INPUTS];
+    if (dense) {
+      for (int32_t idx = 0; idx < program_.num_inputs; ++idx) {
+        inptrs[idx]     = inputs.accessors[idx].ptr(rect) + start;
+        in_strides[idx] = 1;
+      }
+      evaluate_row(inptrs, in_strides, out.ptr(rect) + start, 1, stop - start);
+      return;
+    }
+    for (int32_t idx = 0; idx < program_.num_inputs; ++idx)
+      in_strides[idx] = inner_stride(inputs.accessors[idx], rect);
+    const size_t out_stride = inner_stride(out, rect);
+    for_each_row(rect, pitches, start, stop, [&](const Point<DIM>& p, size_t count) {
+      for (int32_t idx = 0; idx < program_.num_inputs; ++idx)
+        inptrs[idx] = inputs.accessors[idx].ptr(p);
+      evaluate_row(inptrs, in_strides, out.ptr(p), out_stride, count);
+    });
+  }
+
+ private:
+  VAL* buffer(int32_t reg) { return buffer_.data() + reg * TILE_SIZE; }
+
+  void evaluate_row(const VAL* const* inptrs,
+                    const size_t* in_strides,
+                    VAL* outptr,
+                    size_t out_stride,
+                    size_t count)
+  {
+    const VAL* registers[FUSED_MAX_REGISTERS];
+    const int32_t num_inputs = program_.num_inputs;
+    const int32_t result     = program_.result();
+
+    for (size_t offset = 0; offset < count; offset += TILE_SIZE) {
+      const size_t size = std::min(TILE_SIZE, count - offset);
+
+      // Contiguous inputs are read in place and the others are gathered into their registers
+      for (int32_t idx = 0; idx < num_inputs; ++idx) {
+        const size_t stride = in_strides[idx];
+        const VAL* inptr    = inptrs[idx] + offset * stride;
+        if (stride == 1) {
+          registers[idx] = inptr;
+          continue;
+        }
+        VAL* reg = buffer(idx);
+        for (size_t k = 0; k < size; ++k) reg[k] = inptr[k * stride];
+        registers[idx] = reg;
+      }
+
+      VAL* tile_out = outptr + offset * out_stride;
+      // The last instruction writes straight to a contiguous output
+      for (int32_t idx = 0; idx < program_.num_instructions; ++idx) {
+        auto& inst        = program_.instructions[idx];
+        const int32_t dst = num_inputs + idx;
+        VAL* lhs          = dst == result && out_stride == 1 ? tile_out : buffer(dst);
+        const VAL* rhs1   = registers[inst.src1];
+        if (inst.kind == FusedOpKind::UNARY)
+          ops_.visit_unary(inst.op_code, [&](const auto& func) {
+            for (size_t k = 0; k < size; ++k) lhs[k] = func(rhs1[k]);
+          });
+        else {
+          const VAL* rhs2 = registers[inst.src2];
+          ops_.visit_binary(inst.op_code, [&](const auto& func) {
+            for (size_t k = 0; k < size; ++k) lhs[k] = func(rhs1[k], rhs2[k]);
+          });
+        }
+        registers[dst] = lhs;
+      }
+
+      if (out_stride != 1)
+        for (size_t k = 0; k < size; ++k) tile_out[k * out_stride] = registers[result][k];
+    }
+  }
+
+ private:
+  const FusedProgram& program_;
+  const FusedOps<CODE>& ops_;
+  std::vector<VAL> buffer_;
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,103 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/fused/fused_elementwise.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct FusedElementwiseImplBody;
+
+template <VariantKind KIND>
+struct FusedElementwiseImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<is_fusable_type<CODE>>* = nullptr>
+  void operator()(FusedElementwiseArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    if (volume == 0) return;
+
+    auto out = args.out.write_accessor<VAL, DIM>(rect);
+    FusedInputs<VAL, DIM> inputs;
+    for (int32_t idx = 0; idx < args.program.num_inputs; ++idx)
+      inputs.accessors[idx] = args.inputs[idx].read_accessor<VAL, DIM>(rect);
+
+#ifndef LEGATE_BOUNDS_CHECKS
+    // Check to see if this is dense or not
+    bool dense = out.accessor.is_dense_row_major(rect);
+    for (int32_t idx = 0; idx < args.program.num_inputs; ++idx)
+      dense = dense && inputs.accessors[idx].accessor.is_dense_row_major(rect);
+#else
+    // No dense execution if we're doing bounds checks
+    bool dense = false;
+#endif
+
+    FusedOps<CODE> ops;
+    FusedElementwiseImplBody<KIND, CODE, DIM>()(
+      args.program, ops, out, inputs, pitches, rect, dense);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!is_fusable_type<CODE>>* = nullptr>
+  void operator()(FusedElementwiseArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+// The program comes in as a flat array of (kind, op code, src1, src2) tuples
+static FusedProgram unpack_fused_program(Span<const int32_t> code, int32_t num_inputs)
+{
+  FusedProgram program;
+  program.num_inputs       = num_inputs;
+  program.num_instructions = static_cast<int32_t>(code.size() / 4);
+  assert(num_inputs > 0 && num_inputs <= FUSED_MAX_INPUTS);
+  assert(program.num_instructions > 0 && program.num_instructions <= FUSED_MAX_INSTRUCTIONS);
+  for (int32_t idx = 0; idx < program.num_instructions; ++idx) {
+    auto& inst   = program.instructions[idx];
+    inst.kind    = static_cast<FusedOpKind>(code[4 * idx]);
+    inst.op_code = code[4 * idx + 1];
+    inst.src1    = code[4 * idx + 2];
+    inst.src2    = code[4 * idx + 3];
+    // Instructions only read the inputs and the results of earlier instructions
+    assert(inst.src1 < num_inputs + idx && inst.src2 < num_inputs + idx);
+  }
+  return program;
+}
+
+template <VariantKind KIND>
+static void fused_elementwise_template(TaskContext& context)
+{
+  auto& inputs = context.inputs();
+  auto code    = context.scalars()[0].values<int32_t>();
+
+  FusedElementwiseArgs args{
+    context.outputs()[0], inputs, unpack_fused_program(code, static_cast<int32_t>(inputs.size()))};
+  auto dim = std::max(1, args.out.dim());
+  double_dispatch(dim, args.out.code(), FusedElementwiseImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
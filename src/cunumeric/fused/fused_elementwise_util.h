@@ -0,0 +1,137 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/binary/binary_op_util.h"
+#include "cunumeric/unary/unary_op_util.h"
+
+namespace cunumeric {
+
+enum class FusedOpKind : int32_t {
+  UNARY  = CUNUMERIC_FUSED_UNARY,
+  BINARY = CUNUMERIC_FUSED_BINARY,
+};
+
+// Expressions are capped so that the registers of a point fit in a fixed-size array on the
+// GPU. The Python side never builds larger ones.
+constexpr int32_t FUSED_MAX_INPUTS       = 8;
+constexpr int32_t FUSED_MAX_INSTRUCTIONS = 16;
+constexpr int32_t FUSED_MAX_REGISTERS    = FUSED_MAX_INPUTS + FUSED_MAX_INSTRUCTIONS;
+
+// A fused expression is a straight-line program over a register file. The first registers
+// hold the inputs of the task in order, and instruction i writes register num_inputs + i.
+// The register of the last instruction holds the output.
+struct FusedInstruction {
+  FusedOpKind kind;
+  int32_t op_code;
+  int32_t src1;
+  // Unused by unary instructions
+  int32_t src2;
+};
+
+struct FusedProgram {
+  int32_t num_inputs;
+  int32_t num_instructions;
+  FusedInstruction instructions[FUSED_MAX_INSTRUCTIONS];
+
+  __CUDA_HD__ int32_t result() const { return num_inputs + num_instructions - 1; }
+};
+
+// Only floating-point expressions are fused, for which each of the operators below maps the
+// value type to itself
+template <legate::Type::Code CODE>
+constexpr bool is_fusable_type =
+  CODE == legate::Type::Code::FLOAT32 || CODE == legate::Type::Code::FLOAT64;
+
+// The operators that fused expressions can use. A visit calls `func` with the operator of an
+// op code, which lets the host bodies run a whole tile through a single operator and the GPU
+// interpreter a single point.
+template <legate::Type::Code CODE>
+struct FusedOps {
+  // None of the operators takes extra arguments
+  FusedOps() : FusedOps(std::vector<legate::Store>{}) {}
+  FusedOps(const std::vector<legate::Store>& args)
+    : absolute(args),
+      exp(args),
+      log(args),
+      negative(args),
+      sqrt(args),
+      square(args),
+      add(args),
+      divide(args),
+      maximum(args),
+      minimum(args),
+      multiply(args),
+      subtract(args)
+  {
+  }
+
+  template <typename Function>
+  __CUDA_HD__ decltype(auto) visit_unary(int32_t op_code, Function&& func) const
+  {
+    switch (static_cast<UnaryOpCode>(op_code)) {
+      case UnaryOpCode::ABSOLUTE: return func(absolute);
+      case UnaryOpCode::EXP: return func(exp);
+      case UnaryOpCode::LOG: return func(log);
+      case UnaryOpCode::NEGATIVE: return func(negative);
+      case UnaryOpCode::SQRT: return func(sqrt);
+      case UnaryOpCode::SQUARE: return func(square);
+      default: break;
+    }
+    assert(false);
+    return func(negative);
+  }
+
+  template <typename Function>
+  __CUDA_HD__ decltype(auto) visit_binary(int32_t op_code, Function&& func) const
+  {
+    switch (static_cast<BinaryOpCode>(op_code)) {
+      case BinaryOpCode::ADD: return func(add);
+      case BinaryOpCode::DIVIDE: return func(divide);
+      case BinaryOpCode::MAXIMUM: return func(maximum);
+      case BinaryOpCode::MINIMUM: return func(minimum);
+      case BinaryOpCode::MULTIPLY: return func(multiply);
+      case BinaryOpCode::SUBTRACT: return func(subtract);
+      default: break;
+    }
+    assert(false);
+    return func(add);
+  }
+
+  UnaryOp<UnaryOpCode::ABSOLUTE, CODE> absolute;
+  UnaryOp<UnaryOpCode::EXP, CODE> exp;
+  UnaryOp<UnaryOpCode::LOG, CODE> log;
+  UnaryOp<UnaryOpCode::NEGATIVE, CODE> negative;
+  UnaryOp<UnaryOpCode::SQRT, CODE> sqrt;
+  UnaryOp<UnaryOpCode::SQUARE, CODE> square;
+  BinaryOp<BinaryOpCode::ADD, CODE> add;
+  BinaryOp<BinaryOpCode::DIVIDE, CODE> divide;
+  BinaryOp<BinaryOpCode::MAXIMUM, CODE> maximum;
+  BinaryOp<BinaryOpCode::MINIMUM, CODE> minimum;
+  BinaryOp<BinaryOpCode::MULTIPLY, CODE> multiply;
+  BinaryOp<BinaryOpCode::SUBTRACT, CODE> subtract;
+};
+
+// The accessors of the inputs are kept in a fixed-size array, so that the GPU kernels can
+// take them by value
+template <typename VAL, int DIM>
+struct FusedInputs {
+  legate::AccessorRO<VAL, DIM> accessors[FUSED_MAX_INPUTS];
+};
+
+}  // namespace cunumeric
@@ -182,6 +182,7 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       mappings.back().policy.exact = true;
       return std::move(mappings);
     }
+    case CUNUMERIC_PARTITION:
     case CUNUMERIC_SORT: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
@@ -198,23 +199,11 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       }
       return std::move(mappings);
     }
-    case CUNUMERIC_SCAN_LOCAL: {
-      std::vector<StoreMapping> mappings;
-      auto& inputs  = task.inputs();
-      auto& outputs = task.outputs();
-      for (auto& input : inputs) {
-        mappings.push_back(StoreMapping::default_mapping(input, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      for (auto& output : outputs) {
-        mappings.push_back(StoreMapping::default_mapping(output, options.front()));
-        mappings.back().policy.ordering.set_c_order();
-        mappings.back().policy.exact = true;
-      }
-      return std::move(mappings);
-    }
+    case CUNUMERIC_SCAN_LOCAL:
     case CUNUMERIC_SCAN_GLOBAL: {
+      // The host variants scan along any axis of stores in any layout, so only the GPU variants
+      // need the stores in C order with the scan axis last
+      if (options.front() != StoreTarget::FBMEM) return {};
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
       auto& outputs = task.outputs();
@@ -0,0 +1,79 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/pitches.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cunumeric {
+
+// Helpers for the elementwise tasks to walk non-dense stores (e.g., broadcast, sliced, or
+// transposed ones) without unflattening every point. A range of the row-major linearization
+// of a rectangle is visited one row at a time, where a row is a run of points along the
+// innermost dimension. The task bodies then loop over each row with plain pointers stepped
+// by the innermost stride of each accessor, which is constant for affine accessors.
+
+// Returns the distance in elements between consecutive points along the innermost dimension
+// of an affine accessor. The distance is zero when the dimension is broadcast. Stores never
+// have negative strides, as reversed views are materialized by the tasks that create them.
+template <typename ACC, int DIM>
+inline size_t inner_stride(const ACC& acc, const legate::Rect<DIM>& rect)
+{
+  using VAL = std::remove_pointer_t<decltype(acc.ptr(rect.lo))>;
+  return static_cast<size_t>(acc.accessor.strides[DIM - 1]) / sizeof(VAL);
+}
+
+// Returns true if every point of `rect` maps to the same element of an affine accessor,
+// which is the case for a scalar broadcast to the shape of the other operands
+template <typename ACC, int DIM>
+inline bool is_scalar_broadcast(const ACC& acc, const legate::Rect<DIM>& rect)
+{
+  for (int32_t dim = 0; dim < DIM; ++dim)
+    if (rect.hi[dim] > rect.lo[dim] && acc.accessor.strides[dim] != 0) return false;
+  return true;
+}
+
+// Calls `func(point, count)` for each row of the points in [start, stop) of the row-major
+// linearization of `rect`, where `point` is the first point of the row and `count` is the
+// number of points in it that fall into the range. Only the first point of the range is
+// unflattened, and moving on to the next row carries into the outer dimensions.
+template <int DIM, typename Function>
+inline void for_each_row(const legate::Rect<DIM>& rect,
+                         const Pitches<DIM - 1>& pitches,
+                         size_t start,
+                         size_t stop,
+                         Function&& func)
+{
+  if (start >= stop) return;
+  const size_t row_size = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  auto point            = pitches.unflatten(start, rect.lo);
+  for (size_t idx = start; idx < stop;) {
+    const size_t offset = point[DIM - 1] - rect.lo[DIM - 1];
+    const size_t count  = std::min(row_size - offset, stop - idx);
+    func(point, count);
+    idx += count;
+    point[DIM - 1] = rect.lo[DIM - 1];
+    for (int32_t dim = DIM - 2; dim >= 0; --dim) {
+      if (++point[dim] <= rect.hi[dim]) break;
+      point[dim] = rect.lo[dim];
+    }
+  }
+}
+
+}  // namespace cunumeric
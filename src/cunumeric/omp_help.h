@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include "cunumeric/nd_iterator.h"
+
+#include <omp.h>
+#include <utility>
 #include <vector>
 
 namespace cunumeric {
@@ -47,4 +51,30 @@ struct ThreadLocalStorage {
   size_t num_threads_;
 };
 
+// Returns the range [start, stop) of `volume` points that the calling thread of a parallel
+// region gets when the points are split into one contiguous chunk per thread
+inline std::pair<size_t, size_t> thread_range(size_t volume)
+{
+  const size_t num_threads = omp_get_num_threads();
+  const size_t tid         = omp_get_thread_num();
+  const size_t chunk       = (volume + num_threads - 1) / num_threads;
+  const size_t start       = std::min(tid * chunk, volume);
+  return std::make_pair(start, std::min(start + chunk, volume));
+}
+
+// Splits the row-major linearization of `rect` into one contiguous range per thread and
+// visits the rows of each range with `for_each_row`
+template <int DIM, typename Function>
+void parallel_for_each_row(const legate::Rect<DIM>& rect,
+                           const Pitches<DIM - 1>& pitches,
+                           size_t volume,
+                           Function&& func)
+{
+#pragma omp parallel
+  {
+    auto [start, stop] = thread_range(volume);
+    for_each_row(rect, pitches, start, stop, func);
+  }
+}
+
 }  // namespace cunumeric
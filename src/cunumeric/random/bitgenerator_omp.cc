@@ -0,0 +1,65 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/random/bitgenerator.h"
+#include "cunumeric/random/bitgenerator_template.inl"
+#include "cunumeric/random/bitgenerator_util.h"
+
+#include "cunumeric/random/curand_help.h"
+#include "cunumeric/random/randutil/randutil.h"
+
+#include "cunumeric/random/bitgenerator_curand.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+struct OMPGenerator : public CURANDGenerator {
+  OMPGenerator(BitGeneratorType gentype, uint64_t seed, uint64_t generatorId, uint32_t flags)
+    : CURANDGenerator(gentype, seed, generatorId)
+  {
+    CHECK_CURAND(::randutilCreateGeneratorHostParallel(&gen_, type_, seed, generatorId, flags));
+  }
+
+  virtual ~OMPGenerator() { CHECK_CURAND(::randutilDestroyGenerator(gen_)); }
+};
+
+template <>
+struct CURANDGeneratorBuilder<VariantKind::OMP> {
+  static CURANDGenerator* build(BitGeneratorType gentype,
+                                uint64_t seed,
+                                uint64_t generatorId,
+                                uint32_t flags)
+  {
+    return new OMPGenerator(gentype, seed, generatorId, flags);
+  }
+
+  static void destroy(CURANDGenerator* cugenptr) { delete cugenptr; }
+};
+
+template <>
+std::map<legate::Processor, std::unique_ptr<generator_map<VariantKind::OMP>>>
+  BitGeneratorImplBody<VariantKind::OMP>::m_generators = {};
+
+template <>
+std::mutex BitGeneratorImplBody<VariantKind::OMP>::lock_generators = {};
+
+/*static*/ void BitGeneratorTask::omp_variant(TaskContext& context)
+{
+  bitgenerator_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -16,6 +16,7 @@
 
 #include "cunumeric/random/rand.h"
 #include "cunumeric/random/rand_template.inl"
+#include "cunumeric/nd_iterator.h"
 
 namespace cunumeric {
 
@@ -30,12 +31,14 @@ struct RandImplBody<VariantKind::CPU, RNG, VAL, DIM> {
                   const Rect<DIM>& rect) const
   {
     size_t volume = rect.volume();
-    for (size_t idx = 0; idx < volume; ++idx) {
-      const auto point = pitches.unflatten(idx, rect.lo);
-      size_t offset    = 0;
+    const size_t out_stride = inner_stride(out, rect);
+    for_each_row(rect, pitches, 0, volume, [&](const Point<DIM>& point, size_t count) {
+      size_t offset = 0;
       for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
-      out[point] = rng(HI_BITS(offset), LO_BITS(offset));
-    }
+      auto outptr = out.ptr(point);
+      for (size_t idx = 0; idx < count; ++idx, offset += strides[DIM - 1])
+        outptr[idx * out_stride] = rng(HI_BITS(offset), LO_BITS(offset));
+    });
   }
 };
 
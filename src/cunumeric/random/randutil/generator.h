@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <cassert>
+#include <vector>
 
 #include "legate.h"
 #include "randutil_curand.h"
 #include "randutil_impl.h"
+#include "generator_batch.h"
+
+#include <type_traits>
 
 namespace randutilimpl {
 
@@ -64,6 +69,44 @@ struct generatortype<CURAND_RNG_PSEUDO_MRG32K3A> {
   using rng_t = curandStateMRG32k3a_t;
 };
 
+// The uniform and normal draws of these generators are built from their raw 32-bit
+// draws, which the batch kernels of the distributions rely on
+template <typename gen_t>
+struct batch_generator : std::false_type {};
+template <>
+struct batch_generator<curandStateXORWOW_t> : std::true_type {};
+template <>
+struct batch_generator<curandStatePhilox4_32_10_t> : std::true_type {};
+
+// Distributions with a batch kernel turn `batch_draws` raw draws into
+// `batch_samples` samples at a time
+template <typename func_t, typename = void>
+struct has_batch : std::false_type {};
+template <typename func_t>
+struct has_batch<func_t, std::void_t<decltype(func_t::batch_draws)>> : std::true_type {};
+
+static constexpr size_t batch_groups = 256;
+
+template <typename gen_t, typename func_t, typename out_t>
+void host_sample(gen_t& gen, func_t& func, size_t N, out_t* out)
+{
+  size_t k = 0;
+  if constexpr (batch_generator<gen_t>::value && has_batch<func_t>::value) {
+    constexpr size_t draws   = func_t::batch_draws;
+    constexpr size_t samples = func_t::batch_samples;
+    uint32_t buffer[batch_groups * draws];
+    // Samples cached in the state by a previous call must come out first
+    while (k < N && !func.batch_ready(gen)) out[k++] = func(gen);
+    while (N - k >= samples) {
+      const size_t groups = std::min(batch_groups, (N - k) / samples);
+      for (size_t i = 0; i < groups * draws; ++i) buffer[i] = curand(&gen);
+      func.batch(buffer, groups, out + k);
+      k += groups * samples;
+    }
+  }
+  for (; k < N; ++k) out[k] = func(gen);
+}
+
 template <typename gen_t>
 struct inner_generator<gen_t, randutilimpl::execlocation::HOST> : basegenerator {
   uint64_t seed;
@@ -87,7 +130,65 @@ struct inner_generator<gen_t, randutilimpl::execlocation::HOST> : basegenerator
   template <typename func_t, typename out_t>
   curandStatus_t draw(func_t func, size_t N, out_t* out)
   {
-    for (size_t k = 0; k < N; ++k) { out[k] = func(generator); }
+    host_sample(generator, func, N, out);
+    return CURAND_STATUS_SUCCESS;
+  }
+};
+
+// Reverses the bits of `value`, so that consecutive stream ids start far apart
+inline uint32_t bit_reverse(uint32_t value)
+{
+  uint32_t result = 0;
+  for (int bit = 0; bit < 32; ++bit) {
+    result = (result << 1) | (value & 1);
+    value >>= 1;
+  }
+  return result;
+}
+
+// Host generator that splits every draw across OpenMP threads. Like the device
+// generator, it keeps a fixed number of streams that start at skip-ahead offsets of
+// the same subsequence. Each stream fills a contiguous block of the output, so the
+// values only depend on the seed and not on the number of threads.
+template <typename gen_t>
+struct inner_generator<gen_t, randutilimpl::execlocation::HOST_PARALLEL> : basegenerator {
+  static constexpr int nstreams = 512;
+
+  uint64_t seed;
+  uint64_t generatorID;
+  std::vector<gen_t> generators;
+
+  inner_generator(uint64_t seed, uint64_t generatorID, cudaStream_t ignored)
+    : seed(seed), generatorID(generatorID), generators(nstreams)
+  {
+#pragma omp parallel for schedule(static)
+    for (int id = 0; id < nstreams; ++id) {
+      uint64_t offset = ((uint64_t)bit_reverse((uint32_t)id)) << 32;
+      curand_init(seed, generatorID, offset, &generators[id]);
+    }
+  }
+
+  virtual void destroy() override {}
+
+  virtual execlocation location() override { return randutilimpl::execlocation::HOST_PARALLEL; }
+
+  virtual int generatorTypeId() override { return generatorid<gen_t>::rng_type; }
+
+  virtual ~inner_generator() {}
+
+  template <typename func_t, typename out_t>
+  curandStatus_t draw(func_t func, size_t N, out_t* out)
+  {
+    const size_t chunk = (N + nstreams - 1) / nstreams;
+#pragma omp parallel for schedule(static)
+    for (int id = 0; id < nstreams; ++id) {
+      const size_t lo = std::min(N, id * chunk);
+      const size_t hi = std::min(N, lo + chunk);
+      gen_t gen       = generators[id];
+      func_t local    = func;
+      host_sample(gen, local, hi - lo, out + lo);
+      generators[id] = gen;
+    }
     return CURAND_STATUS_SUCCESS;
   }
 };
@@ -129,12 +230,25 @@ struct dispatcher<randutilimpl::execlocation::HOST, func_t, out_t> {
   }
 };
 
+// HOST_PARALLEL-side template instantiation of generator
+template <typename func_t, typename out_t>
+struct dispatcher<randutilimpl::execlocation::HOST_PARALLEL, func_t, out_t> {
+  static curandStatus_t run(randutilimpl::basegenerator* gen, func_t func, size_t N, out_t* out)
+  {
+    return inner_dispatch_sample<randutilimpl::execlocation::HOST_PARALLEL, func_t, out_t>(
+      gen, func, N, out);
+  }
+};
+
 template <typename func_t, typename out_t>
 curandStatus_t dispatch(randutilimpl::basegenerator* gen, func_t func, size_t N, out_t* out)
 {
   switch (gen->location()) {
     case randutilimpl::execlocation::HOST:
       return dispatcher<randutilimpl::execlocation::HOST, func_t, out_t>::run(gen, func, N, out);
+    case randutilimpl::execlocation::HOST_PARALLEL:
+      return dispatcher<randutilimpl::execlocation::HOST_PARALLEL, func_t, out_t>::run(
+        gen, func, N, out);
 #ifdef LEGATE_USE_CUDA
     case randutilimpl::execlocation::DEVICE:
       return dispatcher<randutilimpl::execlocation::DEVICE, func_t, out_t>::run(gen, func, N, out);
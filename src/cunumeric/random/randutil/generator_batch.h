@@ -0,0 +1,52 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Batch kernels of the host generators. Each of them turns a buffer of raw 32-bit
+// draws into samples, exactly as the corresponding scalar functor would, but
+// without the generator state in the loop so that the compiler can vectorize it.
+// They are compiled for several instruction sets and the best one for the running
+// CPU is picked when the library is loaded.
+
+namespace randutilimpl {
+
+// One draw per sample
+void batch_uniform(const uint32_t* draws, size_t n, float* out, float offset, float mult);
+// Two draws per sample
+void batch_uniform(const uint32_t* draws, size_t n, double* out, double offset, double mult);
+
+// One draw per sample
+void batch_exponential(const uint32_t* draws, size_t n, float* out, float scale);
+// Two draws per sample
+void batch_exponential(const uint32_t* draws, size_t n, double* out, double scale);
+
+// Two draws per pair of samples
+void batch_normal(const uint32_t* draws, size_t npairs, float* out, float mean, float stddev);
+// Four draws per pair of samples
+void batch_normal(const uint32_t* draws, size_t npairs, double* out, double mean, double stddev);
+
+// One draw per sample
+void batch_integers(const uint32_t* draws, size_t n, int16_t* out, int16_t from, int16_t to);
+// One draw per sample
+void batch_integers(const uint32_t* draws, size_t n, int32_t* out, int32_t from, int32_t to);
+// Two draws per sample
+void batch_integers(const uint32_t* draws, size_t n, int64_t* out, int64_t from, int64_t to);
+
+}  // namespace randutilimpl
@@ -29,6 +29,21 @@ struct exponential_t<float> {
     float uni = curand_uniform(&gen);
     return -::logf(uni) * scale;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 1;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, float* out) const
+  {
+    randutilimpl::batch_exponential(draws, groups, out, scale);
+  }
 };
 
 template <>
@@ -41,4 +56,19 @@ struct exponential_t<double> {
     double uni = curand_uniform_double(&gen);
     return -::logf(uni) * scale;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 2;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, double* out) const
+  {
+    randutilimpl::batch_exponential(draws, groups, out, scale);
+  }
 };
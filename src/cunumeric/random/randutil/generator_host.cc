@@ -34,6 +34,16 @@ extern "C" curandStatus_t randutilCreateGeneratorHost(randutilGenerator_t* gener
     generator, rng_type, seed, generatorID, nullptr);
 }
 
+extern "C" curandStatus_t randutilCreateGeneratorHostParallel(randutilGenerator_t* generator,
+                                                              curandRngType_t rng_type,
+                                                              uint64_t seed,
+                                                              uint64_t generatorID,
+                                                              uint32_t flags)
+{
+  return inner_randutilCreateGenerator<randutilimpl::execlocation::HOST_PARALLEL>(
+    generator, rng_type, seed, generatorID, nullptr);
+}
+
 extern "C" curandStatus_t randutilDestroyGenerator(randutilGenerator_t generator)
 {
   randutilimpl::basegenerator* gen = (randutilimpl::basegenerator*)generator;
@@ -0,0 +1,102 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "generator.h"
+#include "generator_batch.h"
+
+#include <cmath>
+
+// GCC can clone these loops for several instruction sets and resolve the clone
+// to use at load time from the features of the CPU
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define RANDUTIL_BATCH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RANDUTIL_BATCH_KERNEL
+#endif
+
+namespace randutilimpl {
+
+RANDUTIL_BATCH_KERNEL
+void batch_uniform(const uint32_t* draws, size_t n, float* out, float offset, float mult)
+{
+  for (size_t k = 0; k < n; ++k) out[k] = offset + mult * _curand_uniform(draws[k]);
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_uniform(const uint32_t* draws, size_t n, double* out, double offset, double mult)
+{
+  for (size_t k = 0; k < n; ++k)
+    out[k] = offset + mult * _curand_uniform_double_hq(draws[2 * k], draws[2 * k + 1]);
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_exponential(const uint32_t* draws, size_t n, float* out, float scale)
+{
+  for (size_t k = 0; k < n; ++k) out[k] = -::logf(_curand_uniform(draws[k])) * scale;
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_exponential(const uint32_t* draws, size_t n, double* out, double scale)
+{
+  for (size_t k = 0; k < n; ++k)
+    out[k] = -::logf(_curand_uniform_double_hq(draws[2 * k], draws[2 * k + 1])) * scale;
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_normal(const uint32_t* draws, size_t npairs, float* out, float mean, float stddev)
+{
+  for (size_t k = 0; k < npairs; ++k) {
+    float2 v       = _curand_box_muller(draws[2 * k], draws[2 * k + 1]);
+    out[2 * k]     = stddev * v.x + mean;
+    out[2 * k + 1] = stddev * v.y + mean;
+  }
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_normal(const uint32_t* draws, size_t npairs, double* out, double mean, double stddev)
+{
+  for (size_t k = 0; k < npairs; ++k) {
+    double2 v = _curand_box_muller_double(
+      draws[4 * k], draws[4 * k + 1], draws[4 * k + 2], draws[4 * k + 3]);
+    out[2 * k]     = stddev * v.x + mean;
+    out[2 * k + 1] = stddev * v.y + mean;
+  }
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_integers(const uint32_t* draws, size_t n, int16_t* out, int16_t from, int16_t to)
+{
+  const uint16_t range = (uint16_t)(to - from);
+  for (size_t k = 0; k < n; ++k) out[k] = (int16_t)(draws[k] % range) + from;
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_integers(const uint32_t* draws, size_t n, int32_t* out, int32_t from, int32_t to)
+{
+  const uint32_t range = (uint32_t)(to - from);
+  for (size_t k = 0; k < n; ++k) out[k] = (int32_t)(draws[k] % range) + from;
+}
+
+RANDUTIL_BATCH_KERNEL
+void batch_integers(const uint32_t* draws, size_t n, int64_t* out, int64_t from, int64_t to)
+{
+  for (size_t k = 0; k < n; ++k) {
+    uint64_t value = ((uint64_t)draws[2 * k + 1] << 32) | (uint64_t)draws[2 * k];
+    out[k]         = (int64_t)(value % (to - from)) + from;
+  }
+}
+
+}  // namespace randutilimpl
@@ -29,6 +29,21 @@ struct integers<int16_t> {
   {
     return (int16_t)(curand(&gen) % (uint16_t)(to - from)) + from;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 1;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, int16_t* out) const
+  {
+    randutilimpl::batch_integers(draws, groups, out, from, to);
+  }
 };
 
 template <>
@@ -41,6 +56,21 @@ struct integers<int32_t> {
   {
     return (int32_t)(curand(&gen) % (uint32_t)(to - from)) + from;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 1;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, int32_t* out) const
+  {
+    randutilimpl::batch_integers(draws, groups, out, from, to);
+  }
 };
 
 template <>
@@ -56,4 +86,19 @@ struct integers<int64_t> {
     unsigned high = curand(&gen);
     return (int64_t)((((uint64_t)high << 32) | (uint64_t)low) % (to - from)) + from;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 2;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, int64_t* out) const
+  {
+    randutilimpl::batch_integers(draws, groups, out, from, to);
+  }
 };
@@ -29,6 +29,21 @@ struct normal_t<float> {
   {
     return stddev * curand_normal(&gen) + mean;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 2;
+  static constexpr size_t batch_samples = 2;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return gen.boxmuller_flag != EXTRA_FLAG_NORMAL;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, float* out) const
+  {
+    randutilimpl::batch_normal(draws, groups, out, mean, stddev);
+  }
 };
 
 template <>
@@ -41,4 +56,19 @@ struct normal_t<double> {
   {
     return stddev * curand_normal_double(&gen) + mean;
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 4;
+  static constexpr size_t batch_samples = 2;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return gen.boxmuller_flag_double != EXTRA_FLAG_NORMAL;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, double* out) const
+  {
+    randutilimpl::batch_normal(draws, groups, out, mean, stddev);
+  }
 };
@@ -28,6 +28,21 @@ struct uniform_t<float> {
   {
     return offset + mult * curand_uniform(&gen);
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 1;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, float* out) const
+  {
+    randutilimpl::batch_uniform(draws, groups, out, offset, mult);
+  }
 };
 
 template <>
@@ -39,4 +54,19 @@ struct uniform_t<double> {
   {
     return offset + mult * curand_uniform_double(&gen);
   }
+
+  // Batch kernel, see generator_batch.h
+  static constexpr size_t batch_draws   = 2;
+  static constexpr size_t batch_samples = 1;
+
+  template <typename gen_t>
+  bool batch_ready(const gen_t& gen) const
+  {
+    return true;
+  }
+
+  void batch(const uint32_t* draws, size_t groups, double* out) const
+  {
+    randutilimpl::batch_uniform(draws, groups, out, offset, mult);
+  }
 };
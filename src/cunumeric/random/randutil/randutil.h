@@ -37,6 +37,12 @@ extern "C" curandStatus_t randutilCreateGeneratorHost(randutilGenerator_t* gener
                                                       uint64_t seed,
                                                       uint64_t generatorID,
                                                       uint32_t flags);
+// Host generator that splits every draw across the OpenMP threads
+extern "C" curandStatus_t randutilCreateGeneratorHostParallel(randutilGenerator_t* generator,
+                                                              curandRngType_t rng_type,
+                                                              uint64_t seed,
+                                                              uint64_t generatorID,
+                                                              uint32_t flags);
 extern "C" curandStatus_t randutilDestroyGenerator(randutilGenerator_t generator);
 
 /* curand distributions */
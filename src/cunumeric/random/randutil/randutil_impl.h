@@ -19,7 +19,7 @@
 
 namespace randutilimpl {
 
-enum class execlocation : int { DEVICE = 0, HOST = 1 };
+enum class execlocation : int { DEVICE = 0, HOST = 1, HOST_PARALLEL = 2 };
 
 template <typename gen_t, execlocation loc>
 struct inner_generator;
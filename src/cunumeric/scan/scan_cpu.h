@@ -0,0 +1,180 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/pitches.h"
+
+#include <type_traits>
+
+namespace cunumeric {
+
+// A run of adjacent lanes of a scan, where element (k, j) is step k along the scan axis of
+// lane j. The strides are in elements and can be anything the instance has.
+template <typename T>
+struct ScanView {
+  T* ptr;
+  size_t step;
+  size_t lane;
+
+  T& operator()(legate::coord_t k, legate::coord_t j) const { return ptr[k * step + j * lane]; }
+};
+
+// The lanes of a scan along `axis` of a rectangle. Lanes are independent of each other and are
+// grouped into runs of adjacent lanes along the last dimension, unless the scan axis is the
+// last dimension, in which case every run is a single lane. The scan of a run updates all its
+// lanes at each step along the axis, which vectorizes in the usual row-major layouts and never
+// needs the scan axis to be the contiguous one.
+template <int DIM>
+class ScanRuns {
+ public:
+  ScanRuns(const legate::Rect<DIM>& rect, int32_t axis) : axis_(axis), lo_(rect.lo)
+  {
+    legate::Rect<DIM> starts = rect;
+    starts.hi[axis]          = rect.lo[axis];
+    if (axis != DIM - 1) starts.hi[DIM - 1] = rect.lo[DIM - 1];
+    num_runs_ = pitches_.flatten(starts);
+    length_   = rect.hi[axis] - rect.lo[axis] + 1;
+    width_    = axis == DIM - 1 ? 1 : rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  }
+
+  size_t num_runs() const { return num_runs_; }
+  // Number of steps along the scan axis
+  legate::coord_t length() const { return length_; }
+  // Number of lanes in a run
+  legate::coord_t width() const { return width_; }
+
+  // The first point of lane `lane` of run `run`
+  legate::Point<DIM> start(size_t run, legate::coord_t lane = 0) const
+  {
+    auto point = pitches_.unflatten(run, lo_);
+    point[DIM - 1] += lane;
+    return point;
+  }
+
+  // The point of the total of a lane in the totals that a partition writes, which are zero-based
+  // and have a single element along the scan axis
+  legate::Point<DIM> total(size_t run, legate::coord_t lane = 0) const
+  {
+    auto point   = start(run, lane) - lo_;
+    point[axis_] = 0;
+    return point;
+  }
+
+  // A view of lanes from `lane` on of run `run` in an instance where `base` points at the
+  // lower corner of the rectangle
+  template <typename T>
+  ScanView<T> view(T* base, const size_t strides[DIM], size_t run, legate::coord_t lane = 0) const
+  {
+    auto point    = start(run, lane);
+    size_t offset = 0;
+    for (int32_t dim = 0; dim < DIM; ++dim) offset += (point[dim] - lo_[dim]) * strides[dim];
+    return ScanView<T>{base + offset, strides[axis_], strides[DIM - 1]};
+  }
+
+ private:
+  int32_t axis_;
+  legate::Point<DIM> lo_;
+  Pitches<DIM - 1> pitches_;
+  size_t num_runs_;
+  legate::coord_t length_;
+  legate::coord_t width_;
+};
+
+// Creates the buffer of the totals that a partition writes, with one element per lane
+template <typename VAL, int DIM>
+legate::Buffer<VAL, DIM> create_scan_totals(legate::Store& sum_vals,
+                                            const legate::Rect<DIM>& rect,
+                                            int32_t axis)
+{
+  legate::Point<DIM> extents = rect.hi - rect.lo + legate::Point<DIM>::ONES();
+  extents[axis]              = 1;  // one element along scan axis
+  return sum_vals.create_output_buffer<VAL, DIM>(extents, true);
+}
+
+// Stands for the absence of a prefix in scan_run
+struct NoScanPrefix {};
+
+// Scans `width` lanes of a run, converting each input first. Lane j starts from prefix(j)
+// unless there is no prefix.
+template <typename OP, typename VAL, typename Convert, typename Prefix = NoScanPrefix>
+void scan_run(OP func,
+              ScanView<const VAL> in,
+              ScanView<VAL> out,
+              legate::coord_t length,
+              legate::coord_t width,
+              Convert convert,
+              Prefix prefix = Prefix{})
+{
+  auto first = [&](legate::coord_t j) {
+    if constexpr (std::is_same_v<Prefix, NoScanPrefix>)
+      return convert(in(0, j));
+    else
+      return func(prefix(j), convert(in(0, j)));
+  };
+
+  if (width == 1) {
+    // A single lane keeps its running value in a register
+    VAL acc   = first(0);
+    out(0, 0) = acc;
+    for (legate::coord_t k = 1; k < length; ++k) {
+      acc       = func(acc, convert(in(k, 0)));
+      out(k, 0) = acc;
+    }
+    return;
+  }
+  for (legate::coord_t j = 0; j < width; ++j) out(0, j) = first(j);
+  for (legate::coord_t k = 1; k < length; ++k)
+    for (legate::coord_t j = 0; j < width; ++j) out(k, j) = func(out(k - 1, j), convert(in(k, j)));
+}
+
+// Folds `width` lanes of a run into totals[0, width), converting each input first
+template <typename OP, typename VAL, typename Convert>
+void reduce_run(OP func,
+                ScanView<const VAL> in,
+                legate::coord_t length,
+                legate::coord_t width,
+                Convert convert,
+                VAL* totals)
+{
+  if (width == 1) {
+    VAL acc = convert(in(0, 0));
+    for (legate::coord_t k = 1; k < length; ++k) acc = func(acc, convert(in(k, 0)));
+    totals[0] = acc;
+    return;
+  }
+  for (legate::coord_t j = 0; j < width; ++j) totals[j] = convert(in(0, j));
+  for (legate::coord_t k = 1; k < length; ++k)
+    for (legate::coord_t j = 0; j < width; ++j) totals[j] = func(totals[j], convert(in(k, j)));
+}
+
+// Folds the totals that the partitions before `partition` along the scan axis computed for the
+// lane at `point`
+template <typename OP, typename VAL, int DIM>
+VAL scan_prefix(OP func,
+                const legate::AccessorRO<VAL, DIM>& sum_vals,
+                legate::Point<DIM> point,
+                int32_t axis,
+                legate::coord_t partition)
+{
+  VAL prefix = static_cast<VAL>(OP::nan_identity);
+  for (point[axis] = 0; point[axis] < partition; ++point[axis])
+    prefix = func(prefix, sum_vals[point]);
+  return prefix;
+}
+
+}  // namespace cunumeric
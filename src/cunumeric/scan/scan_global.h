@@ -25,6 +25,7 @@ struct ScanGlobalArgs {
   const Array& sum_vals;
   const Array& out;
   ScanCode op_code;
+  int32_t axis;
   const legate::DomainPoint& partition_index;
 };
 
@@ -16,10 +16,8 @@
 
 #include "cunumeric/scan/scan_global.h"
 #include "cunumeric/scan/scan_global_template.inl"
+#include "cunumeric/scan/scan_cpu.h"
 
-#include <thrust/reduce.h>
-#include <thrust/execution_policy.h>
-#include <thrust/system/omp/execution_policy.h>
 #include <omp.h>
 
 namespace cunumeric {
@@ -34,38 +32,30 @@ struct ScanGlobalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   void operator()(OP func,
                   const AccessorRW<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& sum_vals,
-                  const Pitches<DIM - 1>& out_pitches,
                   const Rect<DIM>& out_rect,
-                  const Pitches<DIM - 1>& sum_vals_pitches,
-                  const Rect<DIM>& sum_vals_rect,
+                  int32_t axis,
                   const DomainPoint& partition_index) const
   {
-    auto outptr = out.ptr(out_rect.lo);
-    auto volume = out_rect.volume();
-
-    if (partition_index[DIM - 1] == 0) {
+    if (partition_index[axis] == 0) {
       // first partition has nothing to do and can return;
       return;
     }
 
-    auto stride = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
-    for (uint64_t index = 0; index < volume; index += stride) {
-      // get the corresponding ND index to use for sum_val
-      auto sum_valsp = out_pitches.unflatten(index, out_rect.lo);
-      // first element on scan axis
-      sum_valsp[DIM - 1]     = 0;
-      auto sum_valsp_end     = sum_valsp;
-      sum_valsp_end[DIM - 1] = partition_index[DIM - 1];
-      auto global_prefix     = thrust::reduce(thrust::omp::par,
-                                          &sum_vals[sum_valsp],
-                                          &sum_vals[sum_valsp_end],
-                                          (VAL)ScanOp<OP_CODE, CODE>::nan_identity,
-                                          func);
-      // apply global_prefix to out
+    ScanRuns<DIM> runs(out_rect, axis);
+    size_t strides[DIM];
+    auto outptr = out.ptr(out_rect, strides);
+
+    const auto width = runs.width();
 #pragma omp parallel for schedule(static)
-      for (uint64_t i = index; i < index + stride; i++) {
-        outptr[i] = func(outptr[i], global_prefix);
-      }
+    for (size_t index = 0; index < runs.num_runs() * width; ++index) {
+      const size_t run   = index / width;
+      const coord_t lane = index % width;
+      auto global_prefix =
+        scan_prefix(func, sum_vals, runs.start(run, lane), axis, partition_index[axis]);
+      // apply global_prefix to out
+      auto lane_out = runs.view(outptr, strides, run, lane);
+      for (coord_t k = 0; k < runs.length(); ++k)
+        lane_out(k, 0) = func(lane_out(k, 0), global_prefix);
     }
   }
 };
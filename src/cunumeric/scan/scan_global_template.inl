@@ -14,6 +14,8 @@
  *
  */
 
+#pragma once
+
 #include "cunumeric/scan/scan_global_util.h"
 #include "cunumeric/pitches.h"
 
@@ -35,25 +37,33 @@ struct ScanGlobalImpl {
     auto out_rect      = args.out.shape<DIM>();
     auto sum_vals_rect = args.sum_vals.shape<DIM>();
 
-    Pitches<DIM - 1> out_pitches;
-    size_t volume = out_pitches.flatten(out_rect);
-    Pitches<DIM - 1> sum_vals_pitches;
-    size_t sum_vals_volume = sum_vals_pitches.flatten(sum_vals_rect);
-
-    if (volume == 0) return;
+    if (out_rect.empty()) return;
 
     auto out      = args.out.read_write_accessor<VAL, DIM>(out_rect);
     auto sum_vals = args.sum_vals.read_accessor<VAL, DIM>(sum_vals_rect);
 
     OP func;
-    ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(func,
-                                                   out,
-                                                   sum_vals,
-                                                   out_pitches,
-                                                   out_rect,
-                                                   sum_vals_pitches,
-                                                   sum_vals_rect,
-                                                   args.partition_index);
+    if constexpr (KIND != VariantKind::GPU) {
+      // The host variants scan along any axis of stores in any layout
+      ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(
+        func, out, sum_vals, out_rect, args.axis, args.partition_index);
+    } else {
+      assert(args.axis == DIM - 1);
+
+      Pitches<DIM - 1> out_pitches;
+      out_pitches.flatten(out_rect);
+      Pitches<DIM - 1> sum_vals_pitches;
+      sum_vals_pitches.flatten(sum_vals_rect);
+
+      ScanGlobalImplBody<KIND, OP_CODE, CODE, DIM>()(func,
+                                                     out,
+                                                     sum_vals,
+                                                     out_pitches,
+                                                     out_rect,
+                                                     sum_vals_pitches,
+                                                     sum_vals_rect,
+                                                     args.partition_index);
+    }
   }
 };
 
@@ -70,8 +80,11 @@ template <VariantKind KIND>
 static void scan_global_template(TaskContext& context)
 {
   auto task_index = context.get_task_index();
-  ScanGlobalArgs args{
-    context.inputs()[1], context.outputs()[0], context.scalars()[0].value<ScanCode>(), task_index};
+  ScanGlobalArgs args{context.inputs()[1],
+                      context.outputs()[0],
+                      context.scalars()[0].value<ScanCode>(),
+                      context.scalars()[1].value<int32_t>(),
+                      task_index};
   op_dispatch(args.op_code, ScanGlobalDispatch<KIND>{}, args);
 }
 
@@ -16,95 +16,94 @@
 
 #include "cunumeric/scan/scan_local.h"
 #include "cunumeric/scan/scan_local_template.inl"
-#include "cunumeric/unary/isnan.h"
-
-#include <thrust/scan.h>
-#include <thrust/execution_policy.h>
-#include <thrust/iterator/transform_iterator.h>
+#include "cunumeric/scan/scan_cpu.h"
 
 namespace cunumeric {
 
 using namespace legate;
 
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
+struct ScanLocalStridedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
   using VAL = legate_type_of<CODE>;
 
+  template <typename Convert>
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
                   Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  Convert convert) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    ScanRuns<DIM> runs(rect, axis);
+    size_t out_strides[DIM], in_strides[DIM];
+    auto outptr      = out.ptr(rect, out_strides);
+    auto inptr       = in.ptr(rect, in_strides);
+    auto sum_valsptr = create_scan_totals<VAL>(sum_vals, rect, axis);
+
+    for (size_t run = 0; run < runs.num_runs(); ++run) {
+      auto run_out = runs.view(outptr, out_strides, run);
+      scan_run(
+        func, runs.view(inptr, in_strides, run), run_out, runs.length(), runs.width(), convert);
+      // write out the partition sums
+      for (coord_t lane = 0; lane < runs.width(); ++lane)
+        sum_valsptr[runs.total(run, lane)] = run_out(runs.length() - 1, lane);
     }
   }
-};
-
-template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
-  using OP  = ScanOp<OP_CODE, CODE>;
-  using VAL = legate_type_of<CODE>;
 
-  struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
+  template <typename Convert>
+  void operator()(OP func,
+                  const AccessorRO<VAL, DIM>& in,
+                  Array& sum_vals,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  Convert convert) const
+  {
+    ScanRuns<DIM> runs(rect, axis);
+    size_t in_strides[DIM];
+    auto inptr       = in.ptr(rect, in_strides);
+    auto sum_valsptr = create_scan_totals<VAL>(sum_vals, rect, axis);
+
+    std::vector<VAL> totals(runs.width());
+    for (size_t run = 0; run < runs.num_runs(); ++run) {
+      reduce_run(func,
+                 runs.view(inptr, in_strides, run),
+                 runs.length(),
+                 runs.width(),
+                 convert,
+                 totals.data());
+      for (coord_t lane = 0; lane < runs.width(); ++lane)
+        sum_valsptr[runs.total(run, lane)] = totals[lane];
     }
-  };
+  }
 
+  template <typename Convert>
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const AccessorRO<VAL, DIM>& sum_vals,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  const DomainPoint& partition_index,
+                  Convert convert) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    ScanRuns<DIM> runs(rect, axis);
+    size_t out_strides[DIM], in_strides[DIM];
+    auto outptr = out.ptr(rect, out_strides);
+    auto inptr  = in.ptr(rect, in_strides);
+
+    for (size_t run = 0; run < runs.num_runs(); ++run) {
+      auto prefix = [&](coord_t lane) {
+        return scan_prefix(func, sum_vals, runs.start(run, lane), axis, partition_index[axis]);
+      };
+      scan_run(func,
+               runs.view(inptr, in_strides, run),
+               runs.view(outptr, out_strides, run),
+               runs.length(),
+               runs.width(),
+               convert,
+               prefix);
     }
   }
 };
@@ -27,6 +27,9 @@ struct ScanLocalArgs {
   Array& sum_vals;
   ScanCode op_code;
   bool nan_to_identity;
+  ScanLocalMode mode;
+  int32_t axis;
+  const legate::DomainPoint& partition_index;
 };
 
 class ScanLocalTask : public CuNumericTask<ScanLocalTask> {
@@ -16,97 +16,191 @@
 
 #include "cunumeric/scan/scan_local.h"
 #include "cunumeric/scan/scan_local_template.inl"
-#include "cunumeric/unary/isnan.h"
+#include "cunumeric/scan/scan_cpu.h"
 
+#include <thrust/reduce.h>
 #include <thrust/scan.h>
 #include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/system/omp/execution_policy.h>
 #include <omp.h>
+#include <algorithm>
+#include <vector>
 
 namespace cunumeric {
 
 using namespace legate;
 
+namespace {
+
+// Lanes are spread over the threads and each is scanned serially, unless every run is a single
+// contiguous lane, there are fewer runs than threads, and the lanes are at least this long, in
+// which case the lanes are scanned one after another with all threads. Many short lanes would
+// otherwise each start a parallel region.
+constexpr size_t PARALLEL_SCAN_MIN_ROW_SIZE = 1 << 16;
+
+template <int DIM>
+bool scan_within_lanes(const ScanRuns<DIM>& runs, size_t in_step, size_t out_step)
+{
+  return runs.width() == 1 && runs.num_runs() < static_cast<size_t>(omp_get_max_threads()) &&
+         static_cast<size_t>(runs.length()) >= PARALLEL_SCAN_MIN_ROW_SIZE && in_step == 1 &&
+         out_step == 1;
+}
+
+// Splits the runs into pieces of adjacent lanes, so that all threads get work even when there
+// are fewer runs than threads, and calls func(run, lane, width) for each piece in parallel
+template <int DIM, typename Function>
+void parallel_for_each_piece(const ScanRuns<DIM>& runs, Function&& func)
+{
+  const size_t num_threads = omp_get_max_threads();
+  const size_t num_runs    = runs.num_runs();
+  const size_t width       = runs.width();
+  const size_t per_run =
+    num_runs >= num_threads ? 1 : std::min(width, (num_threads + num_runs - 1) / num_runs);
+#pragma omp parallel for schedule(static)
+  for (size_t piece = 0; piece < num_runs * per_run; ++piece) {
+    const size_t part = piece % per_run;
+    const size_t lo   = width * part / per_run;
+    const size_t hi   = width * (part + 1) / per_run;
+    func(piece / per_run, static_cast<coord_t>(lo), static_cast<coord_t>(hi - lo));
+  }
+}
+
+// Reads the input of a lane as converted values, with the prefix folded into the first one
+template <typename OP, typename VAL, typename Convert>
+struct PrefixedInput {
+  OP func;
+  const VAL* inptr;
+  VAL prefix;
+  Convert convert;
+
+  VAL operator()(size_t idx) const
+  {
+    return idx == 0 ? func(prefix, convert(inptr[0])) : convert(inptr[idx]);
+  }
+};
+
+}  // namespace
+
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
+struct ScanLocalStridedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
   using VAL = legate_type_of<CODE>;
 
+  template <typename Convert>
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
                   Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  Convert convert) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    ScanRuns<DIM> runs(rect, axis);
+    size_t out_strides[DIM], in_strides[DIM];
+    auto outptr      = out.ptr(rect, out_strides);
+    auto inptr       = in.ptr(rect, in_strides);
+    auto sum_valsptr = create_scan_totals<VAL>(sum_vals, rect, axis);
+
+    const auto length = runs.length();
+    if (scan_within_lanes(runs, in_strides[axis], out_strides[axis])) {
+      for (size_t run = 0; run < runs.num_runs(); ++run) {
+        auto run_in  = runs.view(inptr, in_strides, run);
+        auto run_out = runs.view(outptr, out_strides, run);
+        thrust::inclusive_scan(thrust::omp::par,
+                               thrust::make_transform_iterator(run_in.ptr, convert),
+                               thrust::make_transform_iterator(run_in.ptr + length, convert),
+                               run_out.ptr,
+                               func);
+        sum_valsptr[runs.total(run)] = run_out(length - 1, 0);
+      }
+    } else {
+      parallel_for_each_piece(runs, [&](size_t run, coord_t lane, coord_t width) {
+        auto run_out = runs.view(outptr, out_strides, run, lane);
+        scan_run(func, runs.view(inptr, in_strides, run, lane), run_out, length, width, convert);
+        // write out the partition sums
+        for (coord_t j = 0; j < width; ++j)
+          sum_valsptr[runs.total(run, lane + j)] = run_out(length - 1, j);
+      });
     }
   }
-};
-
-template <ScanCode OP_CODE, Type::Code CODE, int DIM>
-struct ScanLocalNanImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
-  using OP  = ScanOp<OP_CODE, CODE>;
-  using VAL = legate_type_of<CODE>;
 
-  struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
+  template <typename Convert>
+  void operator()(OP func,
+                  const AccessorRO<VAL, DIM>& in,
+                  Array& sum_vals,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  Convert convert) const
+  {
+    ScanRuns<DIM> runs(rect, axis);
+    size_t in_strides[DIM];
+    auto inptr       = in.ptr(rect, in_strides);
+    auto sum_valsptr = create_scan_totals<VAL>(sum_vals, rect, axis);
+
+    const auto length = runs.length();
+    if (scan_within_lanes(runs, in_strides[axis], 1)) {
+      for (size_t run = 0; run < runs.num_runs(); ++run) {
+        auto run_in                  = runs.view(inptr, in_strides, run);
+        sum_valsptr[runs.total(run)] = thrust::reduce(
+          thrust::omp::par,
+          thrust::make_transform_iterator(run_in.ptr, convert),
+          thrust::make_transform_iterator(run_in.ptr + length, convert),
+          static_cast<VAL>(OP::nan_identity),
+          func);
+      }
+    } else {
+      std::vector<std::vector<VAL>> totals(omp_get_max_threads(),
+                                           std::vector<VAL>(runs.width()));
+      parallel_for_each_piece(runs, [&](size_t run, coord_t lane, coord_t width) {
+        auto& local = totals[omp_get_thread_num()];
+        reduce_run(
+          func, runs.view(inptr, in_strides, run, lane), length, width, convert, local.data());
+        for (coord_t j = 0; j < width; ++j) sum_valsptr[runs.total(run, lane + j)] = local[j];
+      });
     }
-  };
+  }
 
+  template <typename Convert>
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  Array& sum_vals,
-                  const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const AccessorRO<VAL, DIM>& sum_vals,
+                  const Rect<DIM>& rect,
+                  int32_t axis,
+                  const DomainPoint& partition_index,
+                  Convert convert) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
+    ScanRuns<DIM> runs(rect, axis);
+    size_t out_strides[DIM], in_strides[DIM];
+    auto outptr = out.ptr(rect, out_strides);
+    auto inptr  = in.ptr(rect, in_strides);
+
+    auto prefix = [&](size_t run, coord_t lane) {
+      return scan_prefix(func, sum_vals, runs.start(run, lane), axis, partition_index[axis]);
+    };
+
+    const auto length = runs.length();
+    if (scan_within_lanes(runs, in_strides[axis], out_strides[axis])) {
+      for (size_t run = 0; run < runs.num_runs(); ++run) {
+        auto run_in = runs.view(inptr, in_strides, run);
+        auto input  = thrust::make_transform_iterator(
+          thrust::make_counting_iterator<size_t>(0),
+          PrefixedInput<OP, VAL, Convert>{func, run_in.ptr, prefix(run, 0), convert});
+        thrust::inclusive_scan(
+          thrust::omp::par, input, input + length, runs.view(outptr, out_strides, run).ptr, func);
+      }
+    } else {
+      parallel_for_each_piece(runs, [&](size_t run, coord_t lane, coord_t width) {
+        scan_run(func,
+                 runs.view(inptr, in_strides, run, lane),
+                 runs.view(outptr, out_strides, run, lane),
+                 length,
+                 width,
+                 convert,
+                 [&](coord_t j) { return prefix(run, lane + j); });
+      });
     }
   }
 };
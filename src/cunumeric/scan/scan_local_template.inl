@@ -27,8 +27,43 @@ struct ScanLocalImplBody;
 template <VariantKind KIND, ScanCode OP_CODE, Type::Code CODE, int DIM>
 struct ScanLocalNanImplBody;
 
+// Bodies of the host variants, which scan along any axis of stores in any layout and run every
+// mode. The GPU variants only run the full scan along the last axis of C-ordered stores.
+template <VariantKind KIND, ScanCode OP_CODE, Type::Code CODE, int DIM>
+struct ScanLocalStridedImplBody;
+
 template <VariantKind KIND, ScanCode OP_CODE, bool NAN_TO_IDENTITY>
 struct ScanLocalImpl {
+  template <Type::Code CODE, int DIM, bool CONVERT_NAN>
+  void strided_scan(ScanLocalArgs& args, const Rect<DIM>& rect) const
+  {
+    using OP  = ScanOp<OP_CODE, CODE>;
+    using VAL = legate_type_of<CODE>;
+
+    auto in      = args.in.read_accessor<VAL, DIM>(rect);
+    auto convert = ScanConvert<OP_CODE, CODE, CONVERT_NAN>{};
+
+    OP func;
+    ScanLocalStridedImplBody<KIND, OP_CODE, CODE, DIM> body;
+    switch (args.mode) {
+      case ScanLocalMode::FULL: {
+        auto out = args.out.write_accessor<VAL, DIM>(rect);
+        body(func, out, in, args.sum_vals, rect, args.axis, convert);
+        break;
+      }
+      case ScanLocalMode::TOTALS: {
+        body(func, in, args.sum_vals, rect, args.axis, convert);
+        break;
+      }
+      case ScanLocalMode::PREFIXED: {
+        auto out      = args.out.write_accessor<VAL, DIM>(rect);
+        auto sum_vals = args.sum_vals.read_accessor<VAL, DIM>(args.sum_vals.shape<DIM>());
+        body(func, out, in, sum_vals, rect, args.axis, args.partition_index, convert);
+        break;
+      }
+    }
+  }
+
   // Case where NANs are transformed
   template <Type::Code CODE,
             int DIM,
@@ -39,21 +74,28 @@ struct ScanLocalImpl {
     using OP  = ScanOp<OP_CODE, CODE>;
     using VAL = legate_type_of<CODE>;
 
-    auto rect = args.out.shape<DIM>();
+    auto rect = args.in.shape<DIM>();
 
-    Pitches<DIM - 1> pitches;
-    size_t volume = pitches.flatten(rect);
-
-    if (volume == 0) {
-      args.sum_vals.bind_empty_data();
+    if (rect.empty()) {
+      if (args.mode != ScanLocalMode::PREFIXED) args.sum_vals.bind_empty_data();
       return;
     }
 
-    auto out = args.out.write_accessor<VAL, DIM>(rect);
-    auto in  = args.in.read_accessor<VAL, DIM>(rect);
+    if constexpr (KIND != VariantKind::GPU) {
+      strided_scan<CODE, DIM, true>(args, rect);
+    } else {
+      assert(args.mode == ScanLocalMode::FULL && args.axis == DIM - 1);
 
-    OP func;
-    ScanLocalNanImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+      Pitches<DIM - 1> pitches;
+      pitches.flatten(rect);
+
+      auto out = args.out.write_accessor<VAL, DIM>(rect);
+      auto in  = args.in.read_accessor<VAL, DIM>(rect);
+
+      OP func;
+      ScanLocalNanImplBody<KIND, OP_CODE, CODE, DIM>()(
+        func, out, in, args.sum_vals, pitches, rect);
+    }
   }
   // Case where NANs are as is
   template <Type::Code CODE,
@@ -65,21 +107,27 @@ struct ScanLocalImpl {
     using OP  = ScanOp<OP_CODE, CODE>;
     using VAL = legate_type_of<CODE>;
 
-    auto rect = args.out.shape<DIM>();
+    auto rect = args.in.shape<DIM>();
 
-    Pitches<DIM - 1> pitches;
-    size_t volume = pitches.flatten(rect);
-
-    if (volume == 0) {
-      args.sum_vals.bind_empty_data();
+    if (rect.empty()) {
+      if (args.mode != ScanLocalMode::PREFIXED) args.sum_vals.bind_empty_data();
       return;
     }
 
-    auto out = args.out.write_accessor<VAL, DIM>(rect);
-    auto in  = args.in.read_accessor<VAL, DIM>(rect);
+    if constexpr (KIND != VariantKind::GPU) {
+      strided_scan<CODE, DIM, false>(args, rect);
+    } else {
+      assert(args.mode == ScanLocalMode::FULL && args.axis == DIM - 1);
 
-    OP func;
-    ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+      Pitches<DIM - 1> pitches;
+      pitches.flatten(rect);
+
+      auto out = args.out.write_accessor<VAL, DIM>(rect);
+      auto in  = args.in.read_accessor<VAL, DIM>(rect);
+
+      OP func;
+      ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+    }
   }
 };
 
@@ -96,11 +144,24 @@ struct ScanLocalDispatch {
 template <VariantKind KIND>
 static void scan_local_template(TaskContext& context)
 {
-  ScanLocalArgs args{context.outputs()[0],
-                     context.inputs()[0],
-                     context.outputs()[1],
+  auto& inputs    = context.inputs();
+  auto& outputs   = context.outputs();
+  auto mode       = context.scalars()[2].value<ScanLocalMode>();
+  auto task_index = context.get_task_index();
+  Array dummy_out;
+  // The pass over the totals writes nothing but the totals, which the prefixed pass reads back
+  auto& out      = mode == ScanLocalMode::TOTALS ? dummy_out : outputs[0];
+  auto& sum_vals = mode == ScanLocalMode::FULL     ? outputs[1]
+                   : mode == ScanLocalMode::TOTALS ? outputs[0]
+                                                   : inputs[1];
+  ScanLocalArgs args{out,
+                     inputs[0],
+                     sum_vals,
                      context.scalars()[0].value<ScanCode>(),
-                     context.scalars()[1].value<bool>()};
+                     context.scalars()[1].value<bool>(),
+                     mode,
+                     context.scalars()[3].value<int32_t>(),
+                     task_index};
   op_dispatch(args.op_code, args.nan_to_identity, ScanLocalDispatch<KIND>{}, args);
 }
 
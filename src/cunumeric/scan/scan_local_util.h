@@ -17,6 +17,7 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/isnan.h"
 
 #include <thrust/functional.h>
 
@@ -27,6 +28,15 @@ enum class ScanCode : int {
   SUM  = CUNUMERIC_SCAN_SUM,
 };
 
+enum class ScanLocalMode : int {
+  // Scans the rows and writes their totals, which SCAN_GLOBAL then adds to later partitions
+  FULL = CUNUMERIC_SCAN_LOCAL_FULL,
+  // Only writes the totals of the rows
+  TOTALS = CUNUMERIC_SCAN_LOCAL_TOTALS,
+  // Scans the rows starting from the totals of the preceding partitions
+  PREFIXED = CUNUMERIC_SCAN_LOCAL_PREFIXED,
+};
+
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) op_dispatch(ScanCode op_code,
                                      bool nan_to_identity,
@@ -67,4 +77,18 @@ struct ScanOp<ScanCode::PROD, CODE> : thrust::multiplies<legate::legate_type_of<
   ScanOp() {}
 };
 
+// Converts the inputs of a scan, replacing NaNs with the identity of the operator if asked to
+template <ScanCode OP_CODE, legate::Type::Code CODE, bool NAN_TO_IDENTITY>
+struct ScanConvert {
+  using VAL = legate::legate_type_of<CODE>;
+
+  __CUDA_HD__ VAL operator()(VAL x) const
+  {
+    if constexpr (NAN_TO_IDENTITY)
+      return cunumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
+    else
+      return x;
+  }
+};
+
 }  // namespace cunumeric
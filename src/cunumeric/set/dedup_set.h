@@ -0,0 +1,117 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/set/unique.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace cunumeric {
+
+// An open-addressing hash set with linear probing, which the host variants of unique use to
+// drop the duplicates of their inputs. Unlike a std::set, it allocates no node per element,
+// and an input with few distinct values keeps the whole table in cache. The keys are hashed by
+// their bits, except that all NaNs share a hash so that they take a single slot. The few other
+// values that compare equal without being identical (0.0 and -0.0) may take several slots, which
+// sorting and deduplicating the extracted keys removes.
+template <typename VAL>
+class DedupSet {
+ public:
+  DedupSet(size_t capacity = 64) { resize(std::max<size_t>(next_power_of_two(capacity), 16)); }
+
+ public:
+  void insert(const VAL& value)
+  {
+    size_t slot = hash(value) & mask_;
+    while (occupied_[slot]) {
+      if (UniqueEqual<VAL>{}(keys_[slot], value)) return;
+      slot = (slot + 1) & mask_;
+    }
+    keys_[slot]     = value;
+    occupied_[slot] = true;
+    // Keep the load factor at or below one half
+    if (++size_ * 2 > keys_.size()) grow();
+  }
+
+  size_t size() const { return size_; }
+
+  // Appends the keys in the order of UniqueLess to `out`, after dropping the duplicates that
+  // compare equal
+  void extract_sorted(std::vector<VAL>& out) const
+  {
+    const size_t offset = out.size();
+    out.reserve(offset + size_);
+    for (size_t slot = 0; slot < keys_.size(); ++slot)
+      if (occupied_[slot]) out.push_back(keys_[slot]);
+    std::sort(out.begin() + offset, out.end(), UniqueLess<VAL>{});
+    out.erase(std::unique(out.begin() + offset, out.end(), UniqueEqual<VAL>{}), out.end());
+  }
+
+ private:
+  static size_t next_power_of_two(size_t value)
+  {
+    size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+  }
+
+  // Mixes the bits of the key with the finalizer of splitmix64
+  static uint64_t hash(const VAL& value)
+  {
+    if (is_nan(value)) return 0;
+    constexpr size_t NUM_WORDS = (sizeof(VAL) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    uint64_t words[NUM_WORDS]  = {};
+    std::memcpy(words, &value, sizeof(VAL));
+    uint64_t result = 0;
+    for (size_t idx = 0; idx < NUM_WORDS; ++idx) {
+      result ^= words[idx] + 0x9e3779b97f4a7c15ULL;
+      result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      result = (result ^ (result >> 27)) * 0x94d049bb133111ebULL;
+      result ^= result >> 31;
+    }
+    return result;
+  }
+
+  void resize(size_t capacity)
+  {
+    keys_.assign(capacity, VAL{});
+    occupied_.assign(capacity, false);
+    mask_ = capacity - 1;
+    size_ = 0;
+  }
+
+  void grow()
+  {
+    auto keys     = std::move(keys_);
+    auto occupied = std::move(occupied_);
+    resize(keys.size() * 2);
+    for (size_t slot = 0; slot < keys.size(); ++slot)
+      if (occupied[slot]) insert(keys[slot]);
+  }
+
+ private:
+  std::vector<VAL> keys_;
+  std::vector<uint8_t> occupied_;
+  size_t mask_{0};
+  size_t size_{0};
+};
+
+}  // namespace cunumeric
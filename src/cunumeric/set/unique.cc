@@ -16,6 +16,8 @@
 
 #include "cunumeric/set/unique.h"
 #include "cunumeric/set/unique_template.inl"
+#include "cunumeric/set/dedup_set.h"
+#include "cunumeric/nd_iterator.h"
 
 namespace cunumeric {
 
@@ -34,16 +36,17 @@ struct UniqueImplBody<VariantKind::CPU, CODE, DIM> {
                   const DomainPoint& point,
                   const Domain& launch_domain)
   {
-    std::set<VAL> dedup_set;
+    DedupSet<VAL> dedup_set;
+    const size_t stride = inner_stride(in, rect);
+    for_each_row(rect, pitches, 0, volume, [&](const auto& row, size_t count) {
+      auto inptr = in.ptr(row);
+      for (size_t idx = 0; idx < count; ++idx) dedup_set.insert(inptr[idx * stride]);
+    });
 
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto p = pitches.unflatten(idx, rect.lo);
-      dedup_set.insert(in[p]);
-    }
-
-    auto result = output.create_output_buffer<VAL, 1>(dedup_set.size(), true);
-    size_t pos  = 0;
-    for (auto e : dedup_set) result[pos++] = e;
+    std::vector<VAL> values;
+    dedup_set.extract_sorted(values);
+    auto result = output.create_output_buffer<VAL, 1>(values.size(), true);
+    for (size_t idx = 0; idx < values.size(); ++idx) result[idx] = values[idx];
   }
 };
 
@@ -106,8 +106,10 @@ static Piece<VAL> tree_reduce(Array& output,
                     p_mine + my_piece.second,
                     p_other,
                     p_other + other_piece.second,
-                    p_merged);
-      auto* end = thrust::unique(DEFAULT_POLICY.on(stream), p_merged, p_merged + merged_size);
+                    p_merged,
+                    UniqueLess<VAL>{});
+      auto* end = thrust::unique(
+        DEFAULT_POLICY.on(stream), p_merged, p_merged + merged_size, UniqueEqual<VAL>{});
 
       // Make sure we release the memory so that we can reuse it
       my_piece.first.destroy();
@@ -171,8 +173,8 @@ struct UniqueImplBody<VariantKind::GPU, CODE, DIM> {
       CHECK_CUDA_STREAM(stream);
 
       // Find unique values
-      thrust::sort(DEFAULT_POLICY.on(stream), ptr, ptr + volume);
-      end = thrust::unique(DEFAULT_POLICY.on(stream), ptr, ptr + volume);
+      thrust::sort(DEFAULT_POLICY.on(stream), ptr, ptr + volume, UniqueLess<VAL>{});
+      end = thrust::unique(DEFAULT_POLICY.on(stream), ptr, ptr + volume, UniqueEqual<VAL>{});
     }
 
     Piece<VAL> result;
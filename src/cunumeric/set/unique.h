@@ -17,9 +17,28 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/unary/isnan.h"
 
 namespace cunumeric {
 
+// The order of the values of unique, which places NaNs last and treats them all as equal, so
+// that they collapse into a single NaN as in NumPy
+template <typename VAL>
+struct UniqueLess {
+  __CUDA_HD__ bool operator()(const VAL& lhs, const VAL& rhs) const
+  {
+    return !is_nan(lhs) && (is_nan(rhs) || lhs < rhs);
+  }
+};
+
+template <typename VAL>
+struct UniqueEqual {
+  __CUDA_HD__ bool operator()(const VAL& lhs, const VAL& rhs) const
+  {
+    return lhs == rhs || (is_nan(lhs) && is_nan(rhs));
+  }
+};
+
 class UniqueTask : public CuNumericTask<UniqueTask> {
  public:
   static const int TASK_ID = CUNUMERIC_UNIQUE;
@@ -16,7 +16,11 @@
 
 #include "cunumeric/set/unique.h"
 #include "cunumeric/set/unique_template.inl"
+#include "cunumeric/set/dedup_set.h"
+#include "cunumeric/nd_iterator.h"
+#include "cunumeric/omp_help.h"
 
+#include <algorithm>
 #include <omp.h>
 
 namespace cunumeric {
@@ -37,38 +41,47 @@ struct UniqueImplBody<VariantKind::OMP, CODE, DIM> {
                   const Domain& launch_domain)
   {
     const auto max_threads = omp_get_max_threads();
-    std::vector<std::set<VAL>> dedup_set(max_threads);
+    std::vector<DedupSet<VAL>> dedup_sets(max_threads);
+    std::vector<std::vector<VAL>> sorted(max_threads);
 
+    const size_t stride = inner_stride(in, rect);
 #pragma omp parallel
     {
       const int tid      = omp_get_thread_num();
-      auto& my_dedup_set = dedup_set[tid];
-#pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        my_dedup_set.insert(in[p]);
-      }
+      auto [start, stop] = thread_range(volume);
+      for_each_row(rect, pitches, start, stop, [&](const auto& row, size_t count) {
+        auto inptr = in.ptr(row);
+        for (size_t idx = 0; idx < count; ++idx) dedup_sets[tid].insert(inptr[idx * stride]);
+      });
+      dedup_sets[tid].extract_sorted(sorted[tid]);
+      dedup_sets[tid] = DedupSet<VAL>();
     }
 
+    // Merge the sorted values of the threads pairwise, halving their number in each round
     size_t remaining = max_threads;
-    size_t radix     = (max_threads + 1) / 2;
     while (remaining > 1) {
-#pragma omp for schedule(static, 1)
-      for (size_t idx = 0; idx < radix; ++idx) {
-        if (idx + radix < remaining) {
-          auto& my_set    = dedup_set[idx];
-          auto& other_set = dedup_set[idx + radix];
-          my_set.insert(other_set.begin(), other_set.end());
-        }
+      const size_t half = (remaining + 1) / 2;
+#pragma omp parallel for schedule(static, 1)
+      for (size_t idx = 0; idx < remaining / 2; ++idx) {
+        auto& mine  = sorted[idx];
+        auto& other = sorted[idx + half];
+        std::vector<VAL> merged(mine.size() + other.size());
+        auto end = std::set_union(mine.begin(),
+                                  mine.end(),
+                                  other.begin(),
+                                  other.end(),
+                                  merged.begin(),
+                                  UniqueLess<VAL>{});
+        merged.erase(end, merged.end());
+        mine.swap(merged);
+        std::vector<VAL>().swap(other);
       }
-      remaining = radix;
-      radix     = (radix + 1) / 2;
+      remaining = half;
     }
 
-    auto& final_dedup_set = dedup_set[0];
-    auto result           = output.create_output_buffer<VAL, 1>(final_dedup_set.size(), true);
-    size_t pos            = 0;
-    for (auto e : final_dedup_set) result[pos++] = e;
+    auto& values = sorted[0];
+    auto result  = output.create_output_buffer<VAL, 1>(values.size(), true);
+    for (size_t idx = 0; idx < values.size(); ++idx) result[idx] = values[idx];
   }
 };
 
@@ -18,11 +18,11 @@
 
 // Useful for IDEs
 #include "cunumeric/set/unique_reduce.h"
+#include "cunumeric/set/unique.h"
 #include "cunumeric/pitches.h"
 
 #include <thrust/copy.h>
-#include <thrust/sort.h>
-#include <thrust/unique.h>
+#include <thrust/set_operations.h>
 #include <thrust/execution_policy.h>
 
 namespace cunumeric {
@@ -44,6 +44,10 @@ struct UniqueReduceImpl {
     auto result  = output.create_output_buffer<VAL, 1>(Point<1>(res_size));
     VAL* res_ptr = result.ptr(0);
 
+    // Each input holds the sorted unique values of one task, so the inputs are merged pairwise
+    // instead of sorting their concatenation. The runs of values move back and forth between
+    // the result and a scratch buffer of the same size.
+    std::vector<std::pair<size_t, size_t>> runs;
     size_t offset = 0;
     for (auto& input_arr : input_arrs) {
       size_t strides[1];
@@ -52,13 +56,39 @@ struct UniqueReduceImpl {
       const VAL* in_ptr = input_arr.read_accessor<VAL, 1>(shape).ptr(shape, strides);
       assert(shape.volume() <= 1 || strides[0] == 1);
       thrust::copy(exe_pol, in_ptr, in_ptr + volume, res_ptr + offset);
+      runs.emplace_back(offset, offset + volume);
       offset += volume;
     }
     assert(offset == res_size);
 
-    thrust::sort(exe_pol, res_ptr, res_ptr + res_size);
-    VAL* actual_end = thrust::unique(exe_pol, res_ptr, res_ptr + res_size);
-    output.bind_data(result, Point<1>(actual_end - res_ptr));
+    auto scratch = create_buffer<VAL>(std::max<size_t>(res_size, 1));
+    VAL* src_ptr = res_ptr;
+    VAL* dst_ptr = scratch.ptr(0);
+    while (runs.size() > 1) {
+      std::vector<std::pair<size_t, size_t>> merged;
+      for (size_t idx = 0; idx < runs.size(); idx += 2) {
+        auto [lo, hi] = runs[idx];
+        if (idx + 1 == runs.size()) {
+          thrust::copy(exe_pol, src_ptr + lo, src_ptr + hi, dst_ptr + lo);
+          merged.emplace_back(lo, hi);
+          continue;
+        }
+        VAL* end = thrust::set_union(exe_pol,
+                                     src_ptr + lo,
+                                     src_ptr + hi,
+                                     src_ptr + runs[idx + 1].first,
+                                     src_ptr + runs[idx + 1].second,
+                                     dst_ptr + lo,
+                                     UniqueLess<VAL>{});
+        merged.emplace_back(lo, end - dst_ptr);
+      }
+      runs.swap(merged);
+      std::swap(src_ptr, dst_ptr);
+    }
+
+    const size_t num_values = runs.empty() ? 0 : runs[0].second - runs[0].first;
+    if (src_ptr != res_ptr) thrust::copy(exe_pol, src_ptr, src_ptr + num_values, res_ptr);
+    output.bind_data(result, Point<1>(num_values));
   }
 };
 
@@ -0,0 +1,51 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/sort/partition.h"
+#include "cunumeric/sort/partition_cpu.inl"
+#include "cunumeric/sort/partition_template.inl"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int32_t DIM>
+struct PartitionImplBody<VariantKind::CPU, CODE, DIM> {
+  void operator()(const PartitionArgs& args,
+                  const Rect<DIM>& rect,
+                  const size_t volume,
+                  const size_t segment_size_l,
+                  const std::vector<comm::Communicator>& comms)
+  {
+    PartitionImplBodyCpu<CODE, DIM>()(args, rect, volume, segment_size_l, thrust::host, comms);
+  }
+};
+
+/*static*/ void PartitionTask::cpu_variant(TaskContext& context)
+{
+  partition_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  auto options = legate::VariantOptions{}.with_concurrent(true);
+  PartitionTask::register_variants({{LEGATE_CPU_VARIANT, options}, {LEGATE_OMP_VARIANT, options}});
+}
+}  // namespace
+
+}  // namespace cunumeric
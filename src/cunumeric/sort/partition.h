@@ -0,0 +1,46 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct PartitionArgs {
+  const Array& input;
+  Array& output;
+  bool argpartition;
+  legate::Span<const int64_t> kths;  // sorted, unique and within [0, segment_size_g)
+  size_t segment_size_g;
+  bool is_index_space;  // !single_task
+  size_t local_rank;
+  size_t num_ranks;
+  size_t num_sort_ranks;
+};
+
+class PartitionTask : public CuNumericTask<PartitionTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_PARTITION;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
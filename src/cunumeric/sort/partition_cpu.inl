@@ -0,0 +1,636 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/partition.h"
+#include "cunumeric/sort/sort_cpu.inl"
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cunumeric {
+
+using namespace legate;
+
+// partition selects on the values themselves
+template <typename VAL>
+struct DirectSelectKeys {
+  using key_t = VAL;
+  bool operator()(const VAL& lhs, const VAL& rhs) const { return lhs < rhs; }
+};
+
+// argpartition selects on positions into the values
+template <typename VAL>
+struct IndirectSelectKeys {
+  using key_t = int64_t;
+  const VAL* values;
+  bool operator()(int64_t lhs, int64_t rhs) const { return values[lhs] < values[rhs]; }
+};
+
+// Reorders the keys of one segment such that the key at each of the ascending positions in
+// `kths` is the one a full sort would put there, with no larger key before and no smaller key
+// after it. Positions are taken relative to `offset`; the ones outside of the segment are ignored.
+template <typename KEYS>
+void select_kths(typename KEYS::key_t* keys,
+                 size_t size,
+                 const int64_t* kths,
+                 size_t num_kths,
+                 int64_t offset,
+                 const KEYS& comp)
+{
+  int64_t lo = 0;
+  for (size_t idx = 0; idx < num_kths; ++idx) {
+    const int64_t kth = kths[idx] - offset;
+    if (kth < lo) continue;
+    if (kth >= static_cast<int64_t>(size)) break;
+    std::nth_element(keys + lo, keys + kth, keys + size, comp);
+    lo = kth + 1;
+  }
+}
+
+// selects the same kths in every one of the equally sized segments
+template <typename KEYS, typename DerivedPolicy>
+void select_kths_segmented(typename KEYS::key_t* keys,
+                           size_t num_segments,
+                           size_t segment_size,
+                           const int64_t* kths,
+                           size_t num_kths,
+                           const KEYS& comp,
+                           const DerivedPolicy& exec)
+{
+  thrust::for_each(exec,
+                   thrust::counting_iterator<size_t>(0),
+                   thrust::counting_iterator<size_t>(num_segments),
+                   [=](size_t segment) {
+                     select_kths(
+                       keys + segment * segment_size, segment_size, kths, num_kths, 0, comp);
+                   });
+}
+
+template <Type::Code CODE, typename DerivedPolicy>
+void sample_select_nd(legate::Buffer<legate_type_of<CODE>> local_values_buffer,
+                      size_t volume,
+                      Array& output_array_unbound,  // only for unbound usage when !rebalance
+                      void* output_ptr,
+                      /* global domain information */
+                      size_t my_rank,  // global rank
+                      size_t num_ranks,
+                      /* domain information in partition dimension */
+                      size_t my_sort_rank,    // local rank id in partition dimension
+                      size_t num_sort_ranks,  // #ranks that share a partition dimension
+                      size_t* sort_ranks,     // rank ids that share a partition dimension with us
+                      size_t segment_size_l,  // (local) segment size
+                      size_t segment_offset,  // global position of our first segment element
+                      /* selection */
+                      const int64_t* kths,
+                      size_t num_kths,
+                      /* other */
+                      bool rebalance,
+                      bool argsort,
+                      const DerivedPolicy& exec,
+                      comm::coll::CollComm comm)
+{
+  using VAL = legate_type_of<CODE>;
+
+  bool is_unbound_1d_storage = output_array_unbound.is_unbound_store();
+
+  assert((volume > 0 && segment_size_l > 0) || volume == segment_size_l);
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 0: detection of empty nodes
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  num_sort_ranks = count_active_sort_ranks(
+    my_rank, num_ranks, my_sort_rank, num_sort_ranks, segment_size_l, volume, comm);
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 1: select and share samples accross partition domain
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // we take the same samples as sample sort does, but only select them instead of sorting the
+  // local data. This leaves every segment split into blocks that each end with a sample, with
+  // all elements of a block lying between the sample before it and its own.
+  size_t num_segments_l            = segment_size_l > 0 ? volume / segment_size_l : 0;
+  size_t num_samples_per_segment_l = num_sort_ranks;
+  size_t num_blocks                = std::min(num_samples_per_segment_l, segment_size_l);
+  size_t num_samples_l             = num_samples_per_segment_l * num_segments_l;
+  size_t num_samples_per_segment_g = num_samples_per_segment_l * num_sort_ranks;
+  size_t num_samples_g             = num_samples_per_segment_g * num_segments_l;
+
+  // position of the last element of every block within a segment
+  std::vector<int64_t> block_ends(num_blocks);
+  for (size_t block = 0; block < num_blocks; ++block) {
+    block_ends[block] = (block + 1) * segment_size_l / num_blocks - 1;
+  }
+
+  auto* local_values = local_values_buffer.ptr(0);
+  auto local_keys    = create_buffer<int64_t>(argsort ? volume : 0);
+  auto* p_keys       = local_keys.ptr(0);
+  if (argsort) {
+    thrust::sequence(exec, p_keys, p_keys + volume, 0);
+    select_kths_segmented(p_keys,
+                          num_segments_l,
+                          segment_size_l,
+                          block_ends.data(),
+                          num_blocks,
+                          IndirectSelectKeys<VAL>{local_values},
+                          exec);
+  } else {
+    select_kths_segmented(local_values,
+                          num_segments_l,
+                          segment_size_l,
+                          block_ends.data(),
+                          num_blocks,
+                          DirectSelectKeys<VAL>{},
+                          exec);
+  }
+  auto value_at = [&](size_t position) -> const VAL& {
+    return argsort ? local_values[p_keys[position]] : local_values[position];
+  };
+
+  auto samples_l  = create_buffer<SegmentSample<VAL>>(num_samples_l);
+  auto samples_g  = create_buffer<SegmentSample<VAL>>(num_samples_g);
+  auto* p_samples = samples_l.ptr(0);
+
+  // the samples are the largest elements of their blocks; we keep them aside as the blocks get
+  // reordered when split below
+  auto block_max = create_buffer<VAL>(num_segments_l * num_blocks);
+
+  {
+    size_t position = 0;
+    for (size_t segment_id_l = 0; segment_id_l < num_segments_l; ++segment_id_l) {
+      for (size_t segment_sample_idx = 0; segment_sample_idx < num_samples_per_segment_l;
+           ++segment_sample_idx) {
+        if (segment_sample_idx < num_blocks) {
+          const size_t index = segment_id_l * segment_size_l + block_ends[segment_sample_idx];
+          p_samples[position].value    = value_at(index);
+          p_samples[position].rank     = my_sort_rank;
+          p_samples[position].segment  = segment_id_l;
+          p_samples[position].position = index;
+
+          block_max[segment_id_l * num_blocks + segment_sample_idx] = value_at(index);
+        } else {
+          // edge case where num_samples_l > volume
+          p_samples[position].rank    = -1;  // not populated
+          p_samples[position].segment = segment_id_l;
+        }
+        position++;
+      }
+    }
+
+    p_samples = samples_g.ptr(0);
+    gather_samples(samples_l.ptr(0),
+                   p_samples,
+                   num_samples_l,
+                   num_ranks,
+                   num_sort_ranks,
+                   sort_ranks,
+                   exec,
+                   comm);
+    samples_l.destroy();
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 2: select splitters from samples and split local data accordingly
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  int32_t num_usable_samples_per_segment =
+    sort_samples(p_samples, num_samples_g, num_samples_per_segment_g, exec);
+
+  // segment_blocks[r][segment]->position in local data for segment and r
+  auto segment_blocks = create_buffer<int32_t>(num_sort_ranks * num_segments_l);
+
+  // initialize sizes to send [r][segment]
+  auto size_send   = create_buffer<int32_t>(num_sort_ranks * (num_segments_l + 1));
+  auto p_size_send = size_send.ptr(0);
+  std::fill(p_size_send, p_size_send + num_sort_ranks * (num_segments_l + 1), 0);
+
+  {
+    for (int32_t segment = 0; segment < num_segments_l; ++segment) {
+      const int32_t segment_start = segment_size_l * segment;
+      const VAL* p_block_max      = block_max.ptr(0) + segment * num_blocks;
+      int32_t start_position      = segment_start;
+      for (int32_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+        int32_t end_position = segment_start + segment_size_l;
+        if (sort_rank < num_sort_ranks - 1) {
+          const int32_t index =
+            (sort_rank + 1) * num_usable_samples_per_segment / (num_sort_ranks)-1;
+          auto& splitter = p_samples[segment * num_samples_per_segment_g + index];
+          if (my_sort_rank == splitter.rank) {
+            // the splitter ends one of our blocks
+            end_position = splitter.position + 1;
+          } else {
+            // ties with the splitter go left if they come from a smaller rank (cf. sample sort)
+            const bool strict = my_sort_rank > splitter.rank;
+            auto goes_left    = [&](const VAL& value) {
+              return strict ? value < splitter.value : !(splitter.value < value);
+            };
+            // all blocks before the first one whose largest element does not go left are taken
+            // entirely, and the ones after it not at all, so we only need to split that block
+            const size_t block =
+              std::partition_point(p_block_max, p_block_max + num_blocks, goes_left) -
+              p_block_max;
+            if (block < num_blocks) {
+              const int32_t block_lo =
+                segment_start + (block > 0 ? block_ends[block - 1] + 1 : 0);
+              const int32_t block_hi = segment_start + block_ends[block] + 1;
+              const int32_t lo       = std::max(block_lo, start_position);
+              const int32_t hi       = std::max(block_hi, lo);
+              if (argsort) {
+                end_position = std::partition(p_keys + lo,
+                                              p_keys + hi,
+                                              [&](int64_t key) {
+                                                return goes_left(local_values[key]);
+                                              }) -
+                               p_keys;
+              } else {
+                end_position =
+                  std::partition(local_values + lo, local_values + hi, goes_left) - local_values;
+              }
+            }
+          }
+          end_position = std::max(end_position, start_position);
+        }
+
+        int32_t size = end_position - start_position;
+
+        size_send[sort_rank * (num_segments_l + 1) + segment] = size;
+
+        // collect sum for rank
+        size_send[sort_rank * (num_segments_l + 1) + num_segments_l] += size;
+
+        segment_blocks[sort_rank * num_segments_l + segment] = start_position;
+
+        start_position = end_position;
+      }
+    }
+  }
+
+  // cleanup intermediate data structures
+  samples_g.destroy();
+  block_max.destroy();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 3: communicate data in partition domain
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // copy values into send buffer
+  auto val_send_buffer = create_buffer<VAL>(volume);
+  auto idc_send_buffer = create_buffer<int64_t>(argsort ? volume : 0);
+
+  auto positions = create_buffer<int32_t>(num_sort_ranks);
+  positions[0]   = 0;
+  for (int32_t sort_rank = 1; sort_rank < num_sort_ranks; ++sort_rank) {
+    positions[sort_rank] =
+      positions[sort_rank - 1] + size_send[(sort_rank - 1) * (num_segments_l + 1) + num_segments_l];
+  }
+
+  // fill send buffers
+  {
+    for (int32_t segment = 0; segment < num_segments_l; ++segment) {
+      for (int32_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+        int32_t start_position = segment_blocks[sort_rank * num_segments_l + segment];
+        int32_t size           = size_send[sort_rank * (num_segments_l + 1) + segment];
+        if (argsort) {
+          for (int32_t idx = 0; idx < size; ++idx) {
+            const int64_t key = p_keys[start_position + idx];
+            val_send_buffer[positions[sort_rank] + idx] = local_values[key];
+            idc_send_buffer[positions[sort_rank] + idx] = segment_offset + key % segment_size_l;
+          }
+        } else {
+          std::memcpy(val_send_buffer.ptr(0) + positions[sort_rank],
+                      local_values + start_position,
+                      size * sizeof(VAL));
+        }
+        positions[sort_rank] += size;
+      }
+    }
+  }
+
+  local_values_buffer.destroy();
+  if (argsort) local_keys.destroy();
+  segment_blocks.destroy();
+  positions.destroy();
+
+  SegmentMergePiece<VAL> merge_buffer = exchange_segment_pieces(size_send,
+                                                                val_send_buffer,
+                                                                idc_send_buffer,
+                                                                num_segments_l,
+                                                                num_ranks,
+                                                                num_sort_ranks,
+                                                                sort_ranks,
+                                                                argsort,
+                                                                exec,
+                                                                comm);
+
+  // cleanup remaining buffers
+  size_send.destroy();
+  val_send_buffer.destroy();
+  if (argsort) idc_send_buffer.destroy();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 4: select the kths within the received pieces
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // the pieces received for a segment follow the ones of all smaller sort ranks in the global
+  // order, so once they are grouped by segment we only need to select the kths that fall into
+  // them, relative to the number of elements the smaller sort ranks received
+  auto segment_sizes  = create_buffer<int64_t>(num_segments_l);
+  auto segment_starts = create_buffer<int64_t>(num_segments_l);
+  if (num_segments_l > 1) {
+    auto* p_segments = merge_buffer.segments.ptr(0);
+    std::fill(segment_sizes.ptr(0), segment_sizes.ptr(0) + num_segments_l, 0);
+    for (size_t idx = 0; idx < merge_buffer.size; ++idx) segment_sizes[p_segments[idx]]++;
+    thrust::exclusive_scan(
+      exec, segment_sizes.ptr(0), segment_sizes.ptr(0) + num_segments_l, segment_starts.ptr(0));
+
+    // stable counting sort by segment
+    auto values  = create_buffer<VAL>(merge_buffer.size);
+    auto indices = create_buffer<int64_t>(argsort ? merge_buffer.size : 0);
+    {
+      auto targets = create_buffer<int64_t>(num_segments_l);
+      std::copy(segment_starts.ptr(0), segment_starts.ptr(0) + num_segments_l, targets.ptr(0));
+      for (size_t idx = 0; idx < merge_buffer.size; ++idx) {
+        const int64_t target = targets[p_segments[idx]]++;
+        values[target]       = merge_buffer.values[idx];
+        if (argsort) indices[target] = merge_buffer.indices[idx];
+      }
+      targets.destroy();
+    }
+    for (size_t segment = 0; segment < num_segments_l; ++segment) {
+      std::fill(p_segments + segment_starts[segment],
+                p_segments + segment_starts[segment] + segment_sizes[segment],
+                segment);
+    }
+    merge_buffer.values.destroy();
+    if (argsort) merge_buffer.indices.destroy();
+    merge_buffer.values  = values;
+    merge_buffer.indices = indices;
+  } else if (num_segments_l == 1) {
+    segment_sizes[0]  = merge_buffer.size;
+    segment_starts[0] = 0;
+  }
+
+  // global position of the received pieces in their segments
+  auto segment_offsets = create_buffer<int64_t>(num_segments_l);
+  {
+    auto all_sizes = create_buffer<int64_t>(num_segments_l * num_sort_ranks);
+
+    // using alltoallv to mimic allgather on subset
+    auto comm_size = create_buffer<int32_t>(num_ranks);
+    auto sdispls   = create_buffer<int32_t>(num_ranks);
+    auto rdispls   = create_buffer<int32_t>(num_ranks);
+
+    std::fill(comm_size.ptr(0), comm_size.ptr(0) + num_ranks, 0);
+    std::fill(sdispls.ptr(0), sdispls.ptr(0) + num_ranks, 0);
+    std::fill(rdispls.ptr(0), rdispls.ptr(0) + num_ranks, 0);
+
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      comm_size[sort_ranks[sort_rank]] = num_segments_l;
+      rdispls[sort_ranks[sort_rank]]   = sort_rank * num_segments_l;
+    }
+
+    comm::coll::collAlltoallv(segment_sizes.ptr(0),
+                              comm_size.ptr(0),  // num_segments_l for all in sort group
+                              sdispls.ptr(0),    // zero for all
+                              all_sizes.ptr(0),
+                              comm_size.ptr(0),  // num_segments_l for all in sort group
+                              rdispls.ptr(0),    // exclusive_scan of recv size
+                              comm::coll::CollDataType::CollInt64,
+                              comm);
+
+    for (size_t segment = 0; segment < num_segments_l; ++segment) {
+      segment_offsets[segment] = 0;
+      for (size_t sort_rank = 0; sort_rank < my_sort_rank && sort_rank < num_sort_ranks;
+           ++sort_rank) {
+        segment_offsets[segment] += all_sizes[sort_rank * num_segments_l + segment];
+      }
+    }
+
+    all_sizes.destroy();
+    comm_size.destroy();
+    sdispls.destroy();
+    rdispls.destroy();
+  }
+
+  if (merge_buffer.size > 0) {
+    auto* p_values  = merge_buffer.values.ptr(0);
+    auto* p_sizes   = segment_sizes.ptr(0);
+    auto* p_starts  = segment_starts.ptr(0);
+    auto* p_offsets = segment_offsets.ptr(0);
+    if (argsort) {
+      auto keys     = create_buffer<int64_t>(merge_buffer.size);
+      auto* p_merge = keys.ptr(0);
+      thrust::sequence(exec, p_merge, p_merge + merge_buffer.size, 0);
+      IndirectSelectKeys<VAL> comp{p_values};
+      thrust::for_each(exec,
+                       thrust::counting_iterator<size_t>(0),
+                       thrust::counting_iterator<size_t>(num_segments_l),
+                       [=](size_t segment) {
+                         select_kths(p_merge + p_starts[segment],
+                                     p_sizes[segment],
+                                     kths,
+                                     num_kths,
+                                     p_offsets[segment],
+                                     comp);
+                       });
+      // only the indices are needed from here on
+      auto indices = create_buffer<int64_t>(merge_buffer.size);
+      auto* p_in   = merge_buffer.indices.ptr(0);
+      auto* p_out  = indices.ptr(0);
+      thrust::for_each(exec,
+                       thrust::counting_iterator<size_t>(0),
+                       thrust::counting_iterator<size_t>(merge_buffer.size),
+                       [=](size_t idx) { p_out[idx] = p_in[p_merge[idx]]; });
+      keys.destroy();
+      merge_buffer.indices.destroy();
+      merge_buffer.indices = indices;
+    } else {
+      DirectSelectKeys<VAL> comp{};
+      thrust::for_each(exec,
+                       thrust::counting_iterator<size_t>(0),
+                       thrust::counting_iterator<size_t>(num_segments_l),
+                       [=](size_t segment) {
+                         select_kths(p_values + p_starts[segment],
+                                     p_sizes[segment],
+                                     kths,
+                                     num_kths,
+                                     p_offsets[segment],
+                                     comp);
+                       });
+    }
+  }
+
+  segment_sizes.destroy();
+  segment_starts.destroy();
+  segment_offsets.destroy();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  /////////////// Part 5: re-balance data to match input/output dimensions
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // moving elements between neighbors keeps the global order of the pieces, so the kths stay
+  // at their positions
+  if (rebalance) {
+    assert(!is_unbound_1d_storage);
+    rebalance_data(merge_buffer,
+                   output_ptr,
+                   my_rank,
+                   num_ranks,
+                   my_sort_rank,
+                   num_sort_ranks,
+                   sort_ranks,
+                   segment_size_l,
+                   num_segments_l,
+                   argsort,
+                   exec,
+                   comm);
+  } else {
+    assert(is_unbound_1d_storage);
+    merge_buffer.segments.destroy();
+    if (argsort) {
+      merge_buffer.values.destroy();
+      output_array_unbound.bind_data(merge_buffer.indices, Point<1>(merge_buffer.size));
+    } else {
+      output_array_unbound.bind_data(merge_buffer.values, Point<1>(merge_buffer.size));
+    }
+  }
+}
+
+template <Type::Code CODE, int32_t DIM>
+struct PartitionImplBodyCpu {
+  using VAL = legate_type_of<CODE>;
+
+  template <typename DerivedPolicy>
+  void operator()(const PartitionArgs& args,
+                  const Rect<DIM>& rect,
+                  const size_t volume,
+                  const size_t segment_size_l,
+                  const DerivedPolicy& exec,
+                  const std::vector<comm::Communicator>& comms)
+  {
+    auto input = args.input.read_accessor<VAL, DIM>(rect);
+
+    // we allow empty domains for distributed partitioning
+    assert(rect.empty() || input.accessor.is_dense_row_major(rect));
+
+    bool is_unbound_1d_storage = args.output.is_unbound_store();
+    bool need_distributed      = segment_size_l != args.segment_size_g || is_unbound_1d_storage;
+    assert(DIM == 1 || !is_unbound_1d_storage);
+
+    size_t num_segments_l = segment_size_l > 0 ? volume / segment_size_l : 0;
+    const VAL* src        = volume > 0 ? input.ptr(rect.lo) : nullptr;
+    const int64_t* kths   = args.kths.ptr();
+    size_t num_kths       = args.kths.size();
+
+    if (!need_distributed) {
+      // every segment is local, so we can select in place in the output
+      if (args.argpartition) {
+        auto output = args.output.write_accessor<int64_t, DIM>(rect);
+        assert(output.accessor.is_dense_row_major(rect));
+        int64_t* indices = output.ptr(rect.lo);
+        thrust::sequence(exec, indices, indices + volume, 0);
+        select_kths_segmented(indices,
+                              num_segments_l,
+                              segment_size_l,
+                              kths,
+                              num_kths,
+                              IndirectSelectKeys<VAL>{src},
+                              exec);
+        thrust::transform(exec,
+                          indices,
+                          indices + volume,
+                          thrust::make_constant_iterator<int64_t>(segment_size_l),
+                          indices,
+                          modulusWithOffset(rect.lo[DIM - 1]));
+      } else {
+        auto output = args.output.write_accessor<VAL, DIM>(rect);
+        assert(output.accessor.is_dense_row_major(rect));
+        VAL* values = output.ptr(rect.lo);
+        if (src != values) std::copy(src, src + volume, values);
+        select_kths_segmented(
+          values, num_segments_l, segment_size_l, kths, num_kths, DirectSelectKeys<VAL>{}, exec);
+      }
+      return;
+    }
+
+    auto values_copy = create_buffer<VAL>(volume);
+    if (volume > 0) std::copy(src, src + volume, values_copy.ptr(0));
+
+    if (!args.is_index_space) {
+      // edge case where we have an unbound store but only 1 CPU was assigned with the task
+      assert(is_unbound_1d_storage);
+      auto* values = values_copy.ptr(0);
+      if (args.argpartition) {
+        auto indices = create_buffer<int64_t>(volume);
+        thrust::sequence(exec, indices.ptr(0), indices.ptr(0) + volume, 0);
+        select_kths(
+          indices.ptr(0), volume, kths, num_kths, 0, IndirectSelectKeys<VAL>{values});
+        values_copy.destroy();
+        args.output.bind_data(indices, Point<1>(volume));
+      } else {
+        select_kths(values, volume, kths, num_kths, 0, DirectSelectKeys<VAL>{});
+        args.output.bind_data(values_copy, Point<1>(volume));
+      }
+      return;
+    }
+
+    std::vector<size_t> sort_ranks(args.num_sort_ranks);
+    size_t rank_group = args.local_rank / args.num_sort_ranks;
+    for (int r = 0; r < args.num_sort_ranks; ++r) {
+      sort_ranks[r] = rank_group * args.num_sort_ranks + r;
+    }
+
+    void* output_ptr = nullptr;
+    // in case the storage *is NOT* unbound -- we provide a target pointer
+    // in case the storage *is* unbound -- the result will be appended to output_array
+    if (volume > 0 && !is_unbound_1d_storage) {
+      if (args.argpartition) {
+        auto output = args.output.write_accessor<int64_t, DIM>(rect);
+        assert(output.accessor.is_dense_row_major(rect));
+        output_ptr = static_cast<void*>(output.ptr(rect.lo));
+      } else {
+        auto output = args.output.write_accessor<VAL, DIM>(rect);
+        assert(output.accessor.is_dense_row_major(rect));
+        output_ptr = static_cast<void*>(output.ptr(rect.lo));
+      }
+    }
+
+    sample_select_nd<CODE>(values_copy,
+                           volume,
+                           args.output,
+                           output_ptr,
+                           args.local_rank,
+                           args.num_ranks,
+                           args.local_rank % args.num_sort_ranks,
+                           args.num_sort_ranks,
+                           sort_ranks.data(),
+                           segment_size_l,
+                           rect.lo[DIM - 1],
+                           kths,
+                           num_kths,
+                           !is_unbound_1d_storage,
+                           args.argpartition,
+                           exec,
+                           comms[0].get<comm::coll::CollComm>());
+  }
+};
+
+}  // namespace cunumeric
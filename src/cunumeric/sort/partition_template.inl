@@ -0,0 +1,82 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/sort/partition.h"
+#include "cunumeric/sort/sort_template.inl"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE, int32_t DIM>
+struct PartitionImplBody;
+
+template <VariantKind KIND>
+struct PartitionImpl {
+  template <Type::Code CODE, int32_t DIM>
+  void operator()(PartitionArgs& args, std::vector<comm::Communicator>& comms) const
+  {
+    auto rect = args.input.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    int64_t segment_size  = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    size_t segment_size_l = segment_size > 0 ? segment_size : 0;
+
+    /*
+     * Assumptions (as for sort):
+     * 1. Partition is always requested for the 'last' dimension within rect
+     * 2. We have product_of_all_other_dimensions independent selection ranges
+     * 3. if data distributed accross partition dimension we perform sample selection
+     */
+
+    // we shall not return on empty rectangle in case of distributed data
+    // as the process needs to participate in collective communication
+    if ((segment_size_l == args.segment_size_g || !args.is_index_space) && rect.empty()) return;
+
+    PartitionImplBody<KIND, CODE, DIM>()(args, rect, volume, segment_size_l, comms);
+  }
+};
+
+template <VariantKind KIND>
+static void partition_template(TaskContext& context)
+{
+  auto shape_span       = context.scalars()[1].values<int64_t>();
+  size_t segment_size_g = shape_span[shape_span.size() - 1];
+  auto domain           = context.get_launch_domain();
+  size_t local_rank     = get_rank(domain, context.get_task_index());
+  size_t num_ranks      = domain.get_volume();
+  size_t num_sort_ranks = domain.hi()[domain.get_dim() - 1] - domain.lo()[domain.get_dim() - 1] + 1;
+
+  PartitionArgs args{context.inputs()[0],
+                     context.outputs()[0],
+                     context.scalars()[0].value<bool>(),      // argpartition
+                     context.scalars()[2].values<int64_t>(),  // kths
+                     segment_size_g,
+                     !context.is_single_task(),
+                     local_rank,
+                     num_ranks,
+                     num_sort_ranks};
+  double_dispatch(
+    args.input.dim(), args.input.code(), PartitionImpl<KIND>{}, args, context.communicators());
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,194 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cunumeric {
+
+// Maps the keys of a radix sort to unsigned integers with the same order, which are then
+// sorted one digit at a time from the least significant one
+template <typename VAL, typename Enable = void>
+struct RadixKey {
+  static constexpr bool SUPPORTED = false;
+};
+
+template <>
+struct RadixKey<bool> {
+  static constexpr bool SUPPORTED = true;
+  using Bits                      = uint8_t;
+
+  static Bits encode(bool value) { return static_cast<Bits>(value); }
+};
+
+// Signed integers have their sign bit flipped, so that the negative ones come first
+template <typename VAL>
+struct RadixKey<VAL, std::enable_if_t<std::is_integral_v<VAL> && !std::is_same_v<VAL, bool>>> {
+  static constexpr bool SUPPORTED = true;
+  using Bits                      = std::make_unsigned_t<VAL>;
+
+  static Bits encode(VAL value)
+  {
+    constexpr Bits SIGN = std::is_signed_v<VAL> ? Bits{1} << (sizeof(Bits) * 8 - 1) : Bits{0};
+    return static_cast<Bits>(static_cast<Bits>(value) ^ SIGN);
+  }
+};
+
+// Floating-point numbers have all their bits flipped when negative and only their sign bit
+// otherwise. Both zeros map to the same key, and NaNs map to the largest key so that they sort
+// last, like they do in NumPy.
+template <typename VAL, typename BITS, BITS INF>
+struct FloatRadixKey {
+  static constexpr bool SUPPORTED = true;
+  using Bits                      = BITS;
+
+  static Bits encode(VAL value)
+  {
+    constexpr Bits SIGN = Bits{1} << (sizeof(Bits) * 8 - 1);
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(Bits));
+    const Bits magnitude = bits & static_cast<Bits>(~SIGN);
+    if (magnitude > INF) return static_cast<Bits>(~Bits{0});
+    if (magnitude == 0) return SIGN;
+    return (bits & SIGN) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | SIGN);
+  }
+};
+
+template <>
+struct RadixKey<__half> : FloatRadixKey<__half, uint16_t, 0x7C00> {};
+
+template <>
+struct RadixKey<float> : FloatRadixKey<float, uint32_t, 0x7F800000> {};
+
+template <>
+struct RadixKey<double> : FloatRadixKey<double, uint64_t, 0x7FF0000000000000> {};
+
+// The order of the host sorts, which is the order of the radix sort for the keys it supports
+// so that segments get the same order whichever way they are sorted
+template <typename VAL>
+struct HostSortLess {
+  bool operator()(const VAL& a, const VAL& b) const
+  {
+    if constexpr (RadixKey<VAL>::SUPPORTED)
+      return RadixKey<VAL>::encode(a) < RadixKey<VAL>::encode(b);
+    else
+      return a < b;
+  }
+};
+
+// Segments of at least this many elements are radix sorted when their type allows it
+constexpr size_t RADIX_SORT_MIN_SIZE = 1 << 12;
+
+constexpr int32_t RADIX_BITS    = 8;
+constexpr size_t RADIX_BUCKETS  = size_t{1} << RADIX_BITS;
+// The input is split into chunks of at least this many elements, each of which is counted and
+// scattered by a single thread of the policy
+constexpr size_t RADIX_CHUNK_SIZE = 1 << 16;
+constexpr size_t RADIX_MAX_CHUNKS = 1024;
+
+// Sorts values in-place with an LSD radix sort, and permutes the indices along with them unless
+// indices is nullptr. Each pass is stable, so the sort is too. Passes in which all keys share
+// the same digit are skipped, which makes keys with a narrow range cheaper to sort.
+template <typename VAL, typename DerivedPolicy>
+void radix_sort(VAL* values, int64_t* indices, const size_t size, const DerivedPolicy& exec)
+{
+  using Key  = RadixKey<VAL>;
+  using Bits = typename Key::Bits;
+
+  const size_t num_chunks =
+    std::clamp<size_t>((size + RADIX_CHUNK_SIZE - 1) / RADIX_CHUNK_SIZE, 1, RADIX_MAX_CHUNKS);
+  const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+  std::vector<size_t> counts(num_chunks * RADIX_BUCKETS);
+  std::vector<VAL> values_tmp(size);
+  std::vector<int64_t> indices_tmp(indices == nullptr ? 0 : size);
+
+  auto* p_counts       = counts.data();
+  VAL* src_values      = values;
+  VAL* dst_values      = values_tmp.data();
+  int64_t* src_indices = indices;
+  int64_t* dst_indices = indices == nullptr ? nullptr : indices_tmp.data();
+
+  for (int32_t shift = 0; shift < static_cast<int32_t>(sizeof(Bits) * 8); shift += RADIX_BITS) {
+    auto digit = [shift](VAL value) {
+      return static_cast<size_t>((Key::encode(value) >> shift) & (RADIX_BUCKETS - 1));
+    };
+    auto chunk_range = [=](size_t chunk) {
+      const size_t lo = std::min(chunk * chunk_size, size);
+      return std::make_pair(lo, std::min(lo + chunk_size, size));
+    };
+
+    // count the digits of each chunk
+    thrust::for_each(exec,
+                     thrust::counting_iterator<size_t>(0),
+                     thrust::counting_iterator<size_t>(num_chunks),
+                     [=](size_t chunk) {
+                       size_t* chunk_counts = p_counts + chunk * RADIX_BUCKETS;
+                       std::fill(chunk_counts, chunk_counts + RADIX_BUCKETS, 0);
+                       auto [lo, hi] = chunk_range(chunk);
+                       for (size_t idx = lo; idx < hi; ++idx)
+                         ++chunk_counts[digit(src_values[idx])];
+                     });
+
+    // turn the counts into the positions where each chunk scatters each digit, with the chunks
+    // of a digit in order so that the pass is stable
+    bool single_digit = false;
+    size_t position   = 0;
+    for (size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+      const size_t start = position;
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        auto& count = p_counts[chunk * RADIX_BUCKETS + bucket];
+        std::swap(count, position);
+        position += count;
+      }
+      single_digit = single_digit || position - start == size;
+    }
+    if (single_digit) continue;
+
+    thrust::for_each(exec,
+                     thrust::counting_iterator<size_t>(0),
+                     thrust::counting_iterator<size_t>(num_chunks),
+                     [=](size_t chunk) {
+                       size_t* positions = p_counts + chunk * RADIX_BUCKETS;
+                       auto [lo, hi]     = chunk_range(chunk);
+                       for (size_t idx = lo; idx < hi; ++idx) {
+                         const size_t pos = positions[digit(src_values[idx])]++;
+                         dst_values[pos]  = src_values[idx];
+                         if (src_indices != nullptr) dst_indices[pos] = src_indices[idx];
+                       }
+                     });
+    std::swap(src_values, dst_values);
+    std::swap(src_indices, dst_indices);
+  }
+
+  if (src_values != values) {
+    thrust::copy(exec, src_values, src_values + size, values);
+    if (indices != nullptr) thrust::copy(exec, src_indices, src_indices + size, indices);
+  }
+}
+
+}  // namespace cunumeric
@@ -16,12 +16,49 @@
 
 #include "cunumeric/sort/searchsorted.h"
 #include "cunumeric/sort/searchsorted_template.inl"
-#include <cub/thread/thread_search.cuh>
 
 #include "cunumeric/cuda_help.h"
 
 namespace cunumeric {
 
+// Binary searches like cub::LowerBound and cub::UpperBound, but in the order of
+// SearchSortedLess, which cub's searches cannot take
+template <typename VAL>
+static __device__ __forceinline__ size_t search_lower_bound(const VAL* sorted,
+                                                            size_t volume,
+                                                            const VAL& value)
+{
+  SearchSortedLess<VAL> less;
+  size_t lo = 0;
+  size_t hi = volume;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (less(sorted[mid], value))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+template <typename VAL>
+static __device__ __forceinline__ size_t search_upper_bound(const VAL* sorted,
+                                                            size_t volume,
+                                                            const VAL& value)
+{
+  SearchSortedLess<VAL> less;
+  size_t lo = 0;
+  size_t hi = volume;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (less(value, sorted[mid]))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
 template <typename VAL, int32_t DIM>
 static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   searchsorted_kernel_min(AccessorRD<MinReduction<int64_t>, false, DIM> output_reduction,
@@ -38,7 +75,8 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   if (v_idx >= num_values) return;
 
   auto v_point        = pitches.unflatten(v_idx, lo);
-  int64_t lower_bound = cub::LowerBound(sorted_array.ptr(global_offset), volume, values[v_point]);
+  int64_t lower_bound =
+    search_lower_bound(sorted_array.ptr(global_offset), volume, values[v_point]);
 
   if (lower_bound < volume) { output_reduction.reduce(v_point, lower_bound + global_offset); }
 }
@@ -59,7 +97,8 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   if (v_idx >= num_values) return;
 
   auto v_point        = pitches.unflatten(v_idx, lo);
-  int64_t upper_bound = cub::UpperBound(sorted_array.ptr(global_offset), volume, values[v_point]);
+  int64_t upper_bound =
+    search_upper_bound(sorted_array.ptr(global_offset), volume, values[v_point]);
 
   if (upper_bound > 0) { output_reduction.reduce(v_point, upper_bound + global_offset); }
 }
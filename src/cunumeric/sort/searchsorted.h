@@ -17,9 +17,15 @@
 #pragma once
 
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/set/unique.h"
 
 namespace cunumeric {
 
+// The sorted arrays hold NaNs last, as NumPy sorts them and unique returns them, so the
+// searches use the same order
+template <typename VAL>
+using SearchSortedLess = UniqueLess<VAL>;
+
 struct SearchSortedArgs {
   const Array& input_base;
   const Array& input_values;
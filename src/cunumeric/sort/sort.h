@@ -18,6 +18,7 @@
 
 #include "cunumeric/cunumeric.h"
 
+#include <thrust/functional.h>
 #include <thrust/sort.h>
 
 namespace cunumeric {
@@ -57,7 +58,9 @@ struct SegmentMergePiece {
   size_t size;
 };
 
-template <typename VAL>
+// orders the samples by segment and then by value with LESS, which must be the order the local
+// pieces are sorted in
+template <typename VAL, typename LESS = thrust::less<VAL>>
 struct SegmentSampleComparator
   : public thrust::binary_function<SegmentSample<VAL>, SegmentSample<VAL>, bool> {
   __CUDA_HD__ bool operator()(const SegmentSample<VAL>& lhs, const SegmentSample<VAL>& rhs) const
@@ -68,8 +71,11 @@ struct SegmentSampleComparator
       // special case for unused samples
       if (lhs.rank < 0 || rhs.rank < 0) { return rhs.rank < 0 && lhs.rank >= 0; }
 
-      if (lhs.value != rhs.value) {
-        return lhs.value < rhs.value;
+      LESS less;
+      if (less(lhs.value, rhs.value)) {
+        return true;
+      } else if (less(rhs.value, lhs.value)) {
+        return false;
       } else if (lhs.rank != rhs.rank) {
         return lhs.rank < rhs.rank;
       } else {
@@ -18,24 +18,82 @@
 
 // Useful for IDEs
 #include "cunumeric/sort/sort.h"
+#include "cunumeric/sort/radix_sort_cpu.inl"
 #include "cunumeric/pitches.h"
 #include "core/comm/coll.h"
 
 #include <thrust/detail/config.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/system/omp/execution_policy.h>
 
+#include <algorithm>
 #include <functional>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 namespace cunumeric {
 
 using namespace legate;
 
+// Segments of up to this many elements are sorted by insertion, which is stable and beats the
+// general sorts on a handful of elements
+constexpr size_t INSERTION_SORT_MAX_SIZE = 32;
+
+// Segments at least this long are sorted one after another, each with the whole policy. Shorter
+// ones are spread over the threads of the policy, which sort them one segment per thread.
+constexpr size_t PARALLEL_SEGMENT_MIN_SIZE = 1 << 16;
+
+// sorts a single segment on the calling thread, if argptr not nullptr it permutes the indices
+template <typename VAL>
+void sort_segment(VAL* inptr, int64_t* argptr, const size_t size, const bool stable_argsort)
+{
+  HostSortLess<VAL> less;
+  if (size <= INSERTION_SORT_MAX_SIZE) {
+    for (size_t idx = 1; idx < size; ++idx) {
+      VAL key    = inptr[idx];
+      size_t pos = idx;
+      if (argptr == nullptr) {
+        for (; pos > 0 && less(key, inptr[pos - 1]); --pos) inptr[pos] = inptr[pos - 1];
+      } else {
+        int64_t arg = argptr[idx];
+        for (; pos > 0 && less(key, inptr[pos - 1]); --pos) {
+          inptr[pos]  = inptr[pos - 1];
+          argptr[pos] = argptr[pos - 1];
+        }
+        argptr[pos] = arg;
+      }
+      inptr[pos] = key;
+    }
+    return;
+  }
+  if constexpr (RadixKey<VAL>::SUPPORTED) {
+    if (size >= RADIX_SORT_MIN_SIZE) {
+      radix_sort(inptr, argptr, size, thrust::seq);
+      return;
+    }
+  }
+  if (argptr == nullptr) {
+    if (stable_argsort) {
+      thrust::stable_sort(thrust::seq, inptr, inptr + size, less);
+    } else {
+      thrust::sort(thrust::seq, inptr, inptr + size, less);
+    }
+  } else {
+    if (stable_argsort) {
+      thrust::stable_sort_by_key(thrust::seq, inptr, inptr + size, argptr, less);
+    } else {
+      thrust::sort_by_key(thrust::seq, inptr, inptr + size, argptr, less);
+    }
+  }
+}
+
 // sorts inptr in-place, if argptr not nullptr it returns sort indices
 template <typename VAL, typename DerivedPolicy>
 void thrust_local_sort_inplace(VAL* inptr,
@@ -45,13 +103,39 @@ void thrust_local_sort_inplace(VAL* inptr,
                                const bool stable_argsort,
                                const DerivedPolicy& exec)
 {
+  const size_t num_segments = volume / sort_dim_size;
+  if (num_segments > 1 && sort_dim_size < PARALLEL_SEGMENT_MIN_SIZE) {
+    thrust::for_each(exec,
+                     thrust::counting_iterator<size_t>(0),
+                     thrust::counting_iterator<size_t>(num_segments),
+                     [=](size_t segment) {
+                       const size_t start_idx = segment * sort_dim_size;
+                       sort_segment(inptr + start_idx,
+                                    argptr == nullptr ? nullptr : argptr + start_idx,
+                                    sort_dim_size,
+                                    stable_argsort);
+                     });
+    return;
+  }
+  if constexpr (RadixKey<VAL>::SUPPORTED) {
+    // radix sort is stable, so stable sorts cost nothing extra
+    if (sort_dim_size >= RADIX_SORT_MIN_SIZE) {
+      for (size_t start_idx = 0; start_idx < volume; start_idx += sort_dim_size)
+        radix_sort(inptr + start_idx,
+                   argptr == nullptr ? nullptr : argptr + start_idx,
+                   sort_dim_size,
+                   exec);
+      return;
+    }
+  }
+  HostSortLess<VAL> less;
   if (argptr == nullptr) {
     // sort (in place)
     for (size_t start_idx = 0; start_idx < volume; start_idx += sort_dim_size) {
       if (stable_argsort) {
-        thrust::stable_sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size);
+        thrust::stable_sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size, less);
       } else {
-        thrust::sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size);
+        thrust::sort(exec, inptr + start_idx, inptr + start_idx + sort_dim_size, less);
       }
     }
   } else {
@@ -60,9 +144,10 @@ void thrust_local_sort_inplace(VAL* inptr,
       int64_t* segmentValues = argptr + start_idx;
       VAL* segmentKeys       = inptr + start_idx;
       if (stable_argsort) {
-        thrust::stable_sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+        thrust::stable_sort_by_key(
+          exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues, less);
       } else {
-        thrust::sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+        thrust::sort_by_key(exec, segmentKeys, segmentKeys + sort_dim_size, segmentValues, less);
       }
     }
   }
@@ -98,20 +183,11 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
     // compute diff for each segment
     auto segment_diff = create_buffer<int64_t>(num_segments_l);
     {
-      if (num_segments_l > 1) {
-        auto* p_segments = merge_buffer.segments.ptr(0);
-        int64_t position = 0;
-        int64_t count    = 0;
-        for (int64_t segment = 0; segment < num_segments_l; ++segment) {
-          while (position < merge_buffer.size && p_segments[position] == segment) {
-            position++;
-            count++;
-          }
-          segment_diff[segment] = count - segment_size_l;
-          count                 = 0;
-        }
-      } else {
-        segment_diff[0] = merge_buffer.size - segment_size_l;
+      // the segments of the merge buffer hold the offsets of the merged segments
+      auto* p_segments = merge_buffer.segments.ptr(0);
+      for (size_t segment = 0; segment < num_segments_l; ++segment) {
+        const size_t size     = p_segments[segment + 1] - p_segments[segment];
+        segment_diff[segment] = static_cast<int64_t>(size) - static_cast<int64_t>(segment_size_l);
       }
     }
 
@@ -441,6 +517,389 @@ void rebalance_data(SegmentMergePiece<VAL>& merge_buffer,
   }
 }
 
+// detects processes that don't want to take part in the computation and returns the number of
+// sort ranks that remain. Note that if segment_size_l>0 && volume==0 means that we have a full
+// sort group being empty, this should not affect local sort rank size.
+inline size_t count_active_sort_ranks(size_t my_rank,
+                                      size_t num_ranks,
+                                      size_t my_sort_rank,
+                                      size_t num_sort_ranks,
+                                      size_t segment_size_l,
+                                      size_t volume,
+                                      comm::coll::CollComm comm)
+{
+  auto worker_counts     = create_buffer<int32_t>(num_ranks);
+  worker_counts[my_rank] = (segment_size_l > 0 ? 1 : 0);
+  comm::coll::collAllgather(
+    worker_counts.ptr(my_rank), worker_counts.ptr(0), 1, comm::coll::CollDataType::CollInt, comm);
+
+  auto p_worker_count = worker_counts.ptr(0);
+  int32_t worker_count =
+    std::accumulate(p_worker_count, p_worker_count + num_ranks, 0, std::plus<int32_t>());
+
+  if (worker_count < num_ranks) {
+    const size_t number_sort_groups = num_ranks / num_sort_ranks;
+    num_sort_ranks                  = worker_count / number_sort_groups;
+
+    if (volume == 0) {
+      // unfortunately we cannot early out here... we still need to participate in collective
+      // communication
+      assert(my_sort_rank >= num_sort_ranks);
+      num_sort_ranks = 0;
+    }
+  }
+  worker_counts.destroy();
+  return num_sort_ranks;
+}
+
+// shares the local samples of every rank with all ranks in its sort group
+template <typename VAL, typename DerivedPolicy>
+void gather_samples(SegmentSample<VAL>* samples_l,
+                    SegmentSample<VAL>* samples_g,
+                    size_t num_samples_l,
+                    size_t num_ranks,
+                    size_t num_sort_ranks,
+                    size_t* sort_ranks,
+                    const DerivedPolicy& exec,
+                    comm::coll::CollComm comm)
+{
+  // This does not work! num_segments_l & num_samples_l not the same for all sort groups!
+  /*comm::coll::collAllgather(samples_l,
+                            samples_g,
+                            num_samples_l * sizeof(SegmentSample<VAL>),
+                            comm::coll::CollDataType::Code::CollUint8,
+                            comm);*/
+
+  // workaround - using alltoallv to mimic allgather on subset
+  auto comm_size = create_buffer<int32_t>(num_ranks);
+  auto sdispls   = create_buffer<int32_t>(num_ranks);
+  auto rdispls   = create_buffer<int32_t>(num_ranks);
+
+  std::fill(comm_size.ptr(0), comm_size.ptr(0) + num_ranks, 0);
+  std::fill(sdispls.ptr(0), sdispls.ptr(0) + num_ranks, 0);
+  for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+    comm_size[sort_ranks[sort_rank]] = num_samples_l * sizeof(SegmentSample<VAL>);
+  }
+  auto p_comm_size = comm_size.ptr(0);
+  thrust::exclusive_scan(exec, p_comm_size, p_comm_size + num_ranks, rdispls.ptr(0), 0);
+
+  comm::coll::collAlltoallv(samples_l,
+                            comm_size.ptr(0),  // num_samples_l*size for all in sort group
+                            sdispls.ptr(0),    // zero for all
+                            samples_g,
+                            comm_size.ptr(0),  // num_samples_l*size for all in sort group
+                            rdispls.ptr(0),    // exclusive_scan of recv size
+                            comm::coll::CollDataType::CollUint8,
+                            comm);
+
+  comm_size.destroy();
+  sdispls.destroy();
+  rdispls.destroy();
+}
+
+// sorts the samples of all segments and returns the number of usable samples per segment
+template <typename VAL, typename DerivedPolicy>
+int32_t sort_samples(SegmentSample<VAL>* p_samples,
+                     size_t num_samples_g,
+                     size_t num_samples_per_segment_g,
+                     const DerivedPolicy& exec)
+{
+  if (num_samples_g > 0) {
+    // the samples are ordered like the local pieces, which places NaNs last
+    thrust::stable_sort(exec,
+                        p_samples,
+                        p_samples + num_samples_g,
+                        SegmentSampleComparator<VAL, HostSortLess<VAL>>());
+  }
+
+  // check whether we have invalid samples (in case one participant did not have enough)
+  int32_t num_usable_samples_per_segment = num_samples_per_segment_g;
+  for (int32_t i = num_samples_per_segment_g - 1; i >= 0; i--) {
+    if (p_samples[i].rank != -1)
+      break;
+    else
+      num_usable_samples_per_segment--;
+  }
+  return num_usable_samples_per_segment;
+}
+
+// sends size_send[r][segment] elements of every segment to sort rank r, where the send buffers
+// are ordered by target rank and then by segment. The last entry of size_send[r] holds the total
+// number of elements sent to r. The returned merge buffer is ordered by source rank and then by
+// segment, and its segments hold the offsets of these sorted runs.
+template <typename VAL, typename DerivedPolicy>
+SegmentMergePiece<VAL> exchange_segment_pieces(legate::Buffer<int32_t>& size_send,
+                                               legate::Buffer<VAL>& val_send_buffer,
+                                               legate::Buffer<int64_t>& idc_send_buffer,
+                                               size_t num_segments_l,
+                                               size_t num_ranks,
+                                               size_t num_sort_ranks,
+                                               size_t* sort_ranks,
+                                               bool argsort,
+                                               const DerivedPolicy& exec,
+                                               comm::coll::CollComm comm)
+{
+  // all2all exchange send/receive sizes  [r][segment]
+  auto size_recv = create_buffer<int32_t>(num_sort_ranks * (num_segments_l + 1));
+
+  {
+    // workaround - using alltoallv
+    auto comm_size = create_buffer<int32_t>(num_ranks);
+    auto displs    = create_buffer<int32_t>(num_ranks);
+
+    std::fill(comm_size.ptr(0), comm_size.ptr(0) + num_ranks, 0);
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      comm_size[sort_ranks[sort_rank]] = num_segments_l + 1;
+    }
+    auto p_comm_size = comm_size.ptr(0);
+    thrust::exclusive_scan(exec, p_comm_size, p_comm_size + num_ranks, displs.ptr(0), 0);
+
+    comm::coll::collAlltoallv(
+      size_send.ptr(0),
+      comm_size.ptr(0),  // (num_segments_l+1)*size for all in sort group
+      displs.ptr(0),     // exclusive_scan of comm_size
+      size_recv.ptr(0),
+      comm_size.ptr(0),  // (num_segments_l+1)*valuesize for all in sort group
+      displs.ptr(0),     // exclusive_scan of comm_size
+      comm::coll::CollDataType::CollInt,
+      comm);
+
+    comm_size.destroy();
+    displs.destroy();
+  }
+
+  // allocate target buffers
+  SegmentMergePiece<VAL> merge_buffer;
+  {
+    int32_t total_receive = 0;
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      total_receive += size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
+    }
+
+    // the segments only hold the offsets of the received runs, the segment of each element is
+    // implied by the run it lies in
+    merge_buffer.segments = create_buffer<size_t>(num_sort_ranks * num_segments_l + 1);
+    auto* p_segments      = merge_buffer.segments.ptr(0);
+    p_segments[0]         = 0;
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      for (size_t segment = 0; segment < num_segments_l; ++segment) {
+        const size_t run    = sort_rank * num_segments_l + segment;
+        const size_t size   = size_recv[sort_rank * (num_segments_l + 1) + segment];
+        p_segments[run + 1] = p_segments[run] + size;
+      }
+    }
+    assert(p_segments[num_sort_ranks * num_segments_l] == total_receive);
+
+    merge_buffer.values  = create_buffer<VAL>(total_receive);
+    merge_buffer.indices = create_buffer<int64_t>(argsort ? total_receive : 0);
+    merge_buffer.size    = total_receive;
+  }
+
+  // communicate all2all (in sort dimension)
+  {
+    auto send_size_total = create_buffer<int32_t>(num_ranks);
+    auto recv_size_total = create_buffer<int32_t>(num_ranks);
+    std::fill(send_size_total.ptr(0), send_size_total.ptr(0) + num_ranks, 0);
+    std::fill(recv_size_total.ptr(0), recv_size_total.ptr(0) + num_ranks, 0);
+
+    auto sdispls = create_buffer<int32_t>(num_ranks);
+    auto rdispls = create_buffer<int32_t>(num_ranks);
+
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      send_size_total[sort_ranks[sort_rank]] =
+        sizeof(VAL) * size_send[sort_rank * (num_segments_l + 1) + num_segments_l];
+      recv_size_total[sort_ranks[sort_rank]] =
+        sizeof(VAL) * size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
+    }
+    auto p_send_size_total = send_size_total.ptr(0);
+    auto p_recv_size_total = recv_size_total.ptr(0);
+    thrust::exclusive_scan(
+      exec, p_send_size_total, p_send_size_total + num_ranks, sdispls.ptr(0), 0);
+    thrust::exclusive_scan(
+      exec, p_recv_size_total, p_recv_size_total + num_ranks, rdispls.ptr(0), 0);
+
+    comm::coll::collAlltoallv(val_send_buffer.ptr(0),
+                              send_size_total.ptr(0),
+                              sdispls.ptr(0),
+                              merge_buffer.values.ptr(0),
+                              recv_size_total.ptr(0),
+                              rdispls.ptr(0),
+                              comm::coll::CollDataType::CollUint8,
+                              comm);
+
+    if (argsort) {
+      for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+        send_size_total[sort_ranks[sort_rank]] =
+          size_send[sort_rank * (num_segments_l + 1) + num_segments_l];
+        recv_size_total[sort_ranks[sort_rank]] =
+          size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
+      }
+
+      thrust::exclusive_scan(
+        exec, p_send_size_total, p_send_size_total + num_ranks, sdispls.ptr(0), 0);
+      thrust::exclusive_scan(
+        exec, p_recv_size_total, p_recv_size_total + num_ranks, rdispls.ptr(0), 0);
+      comm::coll::collAlltoallv(idc_send_buffer.ptr(0),
+                                send_size_total.ptr(0),
+                                sdispls.ptr(0),
+                                merge_buffer.indices.ptr(0),
+                                recv_size_total.ptr(0),
+                                rdispls.ptr(0),
+                                comm::coll::CollDataType::CollInt64,
+                                comm);
+    }
+
+    send_size_total.destroy();
+    recv_size_total.destroy();
+    sdispls.destroy();
+    rdispls.destroy();
+  }
+
+  size_recv.destroy();
+  return merge_buffer;
+}
+
+// Segments of the merge buffer are cut into chunks of about this many elements, which are merged
+// in parallel, but into no more than MERGE_MAX_CHUNKS chunks
+constexpr size_t MERGE_CHUNK_SIZE = 1 << 16;
+constexpr size_t MERGE_MAX_CHUNKS = 256;
+
+// merges the sorted runs [first, second) of values (and indices) into out_values (and
+// out_indices). Equal values are taken from earlier runs first, which keeps the merge stable.
+template <typename VAL>
+void merge_runs(const VAL* values,
+                const int64_t* indices,
+                std::vector<std::pair<size_t, size_t>>& runs,
+                VAL* out_values,
+                int64_t* out_indices)
+{
+  HostSortLess<VAL> less;
+  // the heap holds the runs that are not exhausted yet, with the run of the smallest next value
+  // on top
+  auto after = [&](size_t a, size_t b) {
+    const VAL& value_a = values[runs[a].first];
+    const VAL& value_b = values[runs[b].first];
+    return less(value_b, value_a) || (!less(value_a, value_b) && b < a);
+  };
+  std::vector<size_t> heap;
+  heap.reserve(runs.size());
+  for (size_t run = 0; run < runs.size(); ++run)
+    if (runs[run].first < runs[run].second) heap.push_back(run);
+  std::make_heap(heap.begin(), heap.end(), after);
+
+  size_t position = 0;
+  while (heap.size() > 1) {
+    std::pop_heap(heap.begin(), heap.end(), after);
+    auto& run            = runs[heap.back()];
+    out_values[position] = values[run.first];
+    if (out_indices != nullptr) out_indices[position] = indices[run.first];
+    ++position;
+    if (++run.first < run.second)
+      std::push_heap(heap.begin(), heap.end(), after);
+    else
+      heap.pop_back();
+  }
+  // the last run left is copied as a whole
+  if (!heap.empty()) {
+    auto& run = runs[heap.front()];
+    std::copy(values + run.first, values + run.second, out_values + position);
+    if (out_indices != nullptr)
+      std::copy(indices + run.first, indices + run.second, out_indices + position);
+  }
+}
+
+// merges the sorted runs of the merge buffer, one per source rank and segment, into sorted
+// segments. On entry the segments of the merge buffer hold the offsets of the runs, on return
+// the offsets of the merged segments. Every segment is cut into chunks at values picked from its
+// longest run, and all chunks of all segments are merged in parallel.
+template <typename VAL, typename DerivedPolicy>
+void merge_sorted_runs(SegmentMergePiece<VAL>& merge_buffer,
+                       size_t num_segments_l,
+                       size_t num_sort_ranks,
+                       bool argsort,
+                       const DerivedPolicy& exec)
+{
+  const size_t* p_runs = merge_buffer.segments.ptr(0);
+
+  auto segment_offsets = create_buffer<size_t>(num_segments_l + 1);
+  auto* p_offsets      = segment_offsets.ptr(0);
+  size_t max_size      = 0;
+  p_offsets[0]         = 0;
+  for (size_t segment = 0; segment < num_segments_l; ++segment) {
+    size_t size = 0;
+    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+      const size_t run = sort_rank * num_segments_l + segment;
+      size += p_runs[run + 1] - p_runs[run];
+    }
+    p_offsets[segment + 1] = p_offsets[segment] + size;
+    max_size               = std::max(max_size, size);
+  }
+
+  if (merge_buffer.size > 0) {
+    const size_t num_chunks  = std::clamp<size_t>(max_size / MERGE_CHUNK_SIZE, 1, MERGE_MAX_CHUNKS);
+    auto values              = create_buffer<VAL>(merge_buffer.size);
+    auto indices             = create_buffer<int64_t>(argsort ? merge_buffer.size : 0);
+    const VAL* p_values      = merge_buffer.values.ptr(0);
+    const int64_t* p_indices = argsort ? merge_buffer.indices.ptr(0) : nullptr;
+    VAL* p_out_values        = values.ptr(0);
+    int64_t* p_out_indices   = argsort ? indices.ptr(0) : nullptr;
+
+    thrust::for_each(
+      exec,
+      thrust::counting_iterator<size_t>(0),
+      thrust::counting_iterator<size_t>(num_segments_l * num_chunks),
+      [=](size_t item) {
+        const size_t segment = item / num_chunks;
+        const size_t chunk   = item % num_chunks;
+
+        // bounds of the run of every source rank within the segment
+        std::vector<std::pair<size_t, size_t>> bounds(num_sort_ranks);
+        size_t longest = 0;
+        for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+          const size_t run  = sort_rank * num_segments_l + segment;
+          bounds[sort_rank] = std::make_pair(p_runs[run], p_runs[run + 1]);
+          if (p_runs[run + 1] - p_runs[run] > bounds[longest].second - bounds[longest].first)
+            longest = sort_rank;
+        }
+        const size_t longest_size = bounds[longest].second - bounds[longest].first;
+
+        // elements equal to the value of a cut go to the later chunk in every run, so the chunks
+        // follow each other in the merged segment and ties keep the order of the runs
+        HostSortLess<VAL> less;
+        auto cut = [&](size_t cut_idx, size_t sort_rank) {
+          const auto [first, last] = bounds[sort_rank];
+          if (cut_idx == 0 || longest_size == 0) return first;
+          if (cut_idx == num_chunks) return last;
+          const VAL& value = p_values[bounds[longest].first + cut_idx * longest_size / num_chunks];
+          return static_cast<size_t>(
+            std::lower_bound(p_values + first, p_values + last, value, less) - p_values);
+        };
+
+        std::vector<std::pair<size_t, size_t>> runs(num_sort_ranks);
+        size_t position = p_offsets[segment];
+        for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
+          runs[sort_rank] = std::make_pair(cut(chunk, sort_rank), cut(chunk + 1, sort_rank));
+          position += runs[sort_rank].first - bounds[sort_rank].first;
+        }
+        merge_runs(p_values,
+                   p_indices,
+                   runs,
+                   p_out_values + position,
+                   p_out_indices == nullptr ? nullptr : p_out_indices + position);
+      });
+
+    merge_buffer.values.destroy();
+    merge_buffer.values = values;
+    if (argsort) {
+      merge_buffer.indices.destroy();
+      merge_buffer.indices = indices;
+    }
+  }
+
+  merge_buffer.segments.destroy();
+  merge_buffer.segments = segment_offsets;
+}
+
 template <Type::Code CODE, typename DerivedPolicy>
 void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
                     Array& output_array_unbound,  // only for unbound usage when !rebalance
@@ -471,33 +930,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////// Part 0: detection of empty nodes
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // first of all we need to check for processes that don't want
-  // to take part in the computation. This might lead to a reduction of
-  // sort ranks. Note that if segment_size_l>0 && volume==0 means that we have
-  // a full sort group being empty, this should not affect local sort rank size.
-  {
-    auto worker_counts     = create_buffer<int32_t>(num_ranks);
-    worker_counts[my_rank] = (segment_size_l > 0 ? 1 : 0);
-    comm::coll::collAllgather(
-      worker_counts.ptr(my_rank), worker_counts.ptr(0), 1, comm::coll::CollDataType::CollInt, comm);
-
-    auto p_worker_count = worker_counts.ptr(0);
-    int32_t worker_count =
-      std::accumulate(p_worker_count, p_worker_count + num_ranks, 0, std::plus<int32_t>());
-
-    if (worker_count < num_ranks) {
-      const size_t number_sort_groups = num_ranks / num_sort_ranks;
-      num_sort_ranks                  = worker_count / number_sort_groups;
-
-      if (volume == 0) {
-        // unfortunately we cannot early out here... we still need to participate in collective
-        // communication
-        assert(my_sort_rank >= num_sort_ranks);
-        num_sort_ranks = 0;
-      }
-    }
-    worker_counts.destroy();
-  }
+  num_sort_ranks = count_active_sort_ranks(
+    my_rank, num_ranks, my_sort_rank, num_sort_ranks, segment_size_l, volume, comm);
 
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 1: select and share samples accross sort domain
@@ -546,42 +980,15 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
     }
 
     p_samples = samples_g.ptr(0);
-
-    {
-      // This does not work! num_segments_l & num_samples_l not the same for all sort groups!
-      /*comm::coll::collAllgather(p_samples + num_samples_l * my_sort_rank,
-                                p_samples,
-                                num_samples_l * sizeof(SegmentSample<VAL>),
-                                comm::coll::CollDataType::Code::CollUint8,
-                                comm);*/
-
-      // workaround - using alltoallv to mimic allgather on subset
-      auto comm_size = create_buffer<int32_t>(num_ranks);
-      auto sdispls   = create_buffer<int32_t>(num_ranks);
-      auto rdispls   = create_buffer<int32_t>(num_ranks);
-
-      std::fill(comm_size.ptr(0), comm_size.ptr(0) + num_ranks, 0);
-      std::fill(sdispls.ptr(0), sdispls.ptr(0) + num_ranks, 0);
-      for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-        comm_size[sort_ranks[sort_rank]] = num_samples_l * sizeof(SegmentSample<VAL>);
-      }
-      auto p_comm_size = comm_size.ptr(0);
-      thrust::exclusive_scan(exec, p_comm_size, p_comm_size + num_ranks, rdispls.ptr(0), 0);
-
-      comm::coll::collAlltoallv(samples_l.ptr(0),
-                                comm_size.ptr(0),  // num_samples_l*size for all in sort group
-                                sdispls.ptr(0),    // zero for all
-                                p_samples,
-                                comm_size.ptr(0),  // num_samples_l*size for all in sort group
-                                rdispls.ptr(0),    // exclusive_scan of recv size
-                                comm::coll::CollDataType::CollUint8,
-                                comm);
-
-      samples_l.destroy();
-      comm_size.destroy();
-      sdispls.destroy();
-      rdispls.destroy();
-    }
+    gather_samples(samples_l.ptr(0),
+                   p_samples,
+                   num_samples_l,
+                   num_ranks,
+                   num_sort_ranks,
+                   sort_ranks,
+                   exec,
+                   comm);
+    samples_l.destroy();
   }
 
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -589,24 +996,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
   // sort samples on device
-  if (num_samples_g > 0) {
-    thrust::stable_sort(exec, p_samples, p_samples + num_samples_g, SegmentSampleComparator<VAL>());
-  }
-
-  // check whether we have invalid samples (in case one participant did not have enough)
-  int32_t num_usable_samples_per_segment = num_samples_per_segment_g;
-  for (int32_t i = num_samples_per_segment_g - 1; i >= 0; i--) {
-    if (p_samples[i].rank != -1)
-      break;
-    else
-      num_usable_samples_per_segment--;
-  }
-
-  SegmentSample<VAL> init_sample;
-  init_sample.rank = -1;
-  auto lower_bound = std::lower_bound(
-    p_samples, p_samples + num_samples_per_segment_g, init_sample, SegmentSampleComparator<VAL>());
-  int32_t num_usable_samples = lower_bound - p_samples;
+  int32_t num_usable_samples_per_segment =
+    sort_samples(p_samples, num_samples_g, num_samples_per_segment_g, exec);
 
   // segment_blocks[r][segment]->global position in data for segment and r
   // perform blocksize wide scan on size_send[r][block*blocksize] within warp
@@ -629,16 +1020,18 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
           auto& splitter = p_samples[segment * num_samples_per_segment_g + index];
           if (my_sort_rank > splitter.rank) {
             // position of the last position with smaller value than splitter.value + 1
-            end_position =
-              std::lower_bound(
-                local_values + start_position, local_values + end_position, splitter.value) -
-              local_values;
+            end_position = std::lower_bound(local_values + start_position,
+                                            local_values + end_position,
+                                            splitter.value,
+                                            HostSortLess<VAL>()) -
+                           local_values;
           } else if (my_sort_rank < splitter.rank) {
             // position of the first position with value larger than splitter.value
-            end_position =
-              std::upper_bound(
-                local_values + start_position, local_values + end_position, splitter.value) -
-              local_values;
+            end_position = std::upper_bound(local_values + start_position,
+                                            local_values + end_position,
+                                            splitter.value,
+                                            HostSortLess<VAL>()) -
+                           local_values;
           } else {
             end_position = splitter.position + 1;
           }
@@ -675,35 +1068,6 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////// Part 3: communicate data in sort domain
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // all2all exchange send/receive sizes  [r][segment]
-  auto size_recv = create_buffer<int32_t>(num_sort_ranks * (num_segments_l + 1));
-
-  {
-    // workaround - using alltoallv
-    auto comm_size = create_buffer<int32_t>(num_ranks);
-    auto displs    = create_buffer<int32_t>(num_ranks);
-
-    std::fill(comm_size.ptr(0), comm_size.ptr(0) + num_ranks, 0);
-    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-      comm_size[sort_ranks[sort_rank]] = num_segments_l + 1;
-    }
-    auto p_comm_size = comm_size.ptr(0);
-    thrust::exclusive_scan(exec, p_comm_size, p_comm_size + num_ranks, displs.ptr(0), 0);
-
-    comm::coll::collAlltoallv(
-      size_send.ptr(0),
-      comm_size.ptr(0),  // (num_segments_l+1)*size for all in sort group
-      displs.ptr(0),     // exclusive_scan of comm_size
-      size_recv.ptr(0),
-      comm_size.ptr(0),  // (num_segments_l+1)*valuesize for all in sort group
-      displs.ptr(0),     // exclusive_scan of comm_size
-      comm::coll::CollDataType::CollInt,
-      comm);
-
-    comm_size.destroy();
-    displs.destroy();
-  }
-
   // copy values into send buffer
   auto val_send_buffer = create_buffer<VAL>(volume);
   auto idc_send_buffer = create_buffer<int64_t>(argsort ? volume : 0);
@@ -740,97 +1104,19 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   segment_blocks.destroy();
   positions.destroy();
 
-  // allocate target buffers
-  SegmentMergePiece<VAL> merge_buffer;
-  {
-    int32_t total_receive = 0;
-    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-      total_receive += size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
-    }
-
-    merge_buffer.segments = create_buffer<size_t>(num_segments_l > 1 ? total_receive : 0);
-    if (num_segments_l > 1) {
-      auto* p_segments = merge_buffer.segments.ptr(0);
-      // initialize segment information
-      int32_t start_pos = 0;
-      for (int32_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-        for (int32_t segment = 0; segment < num_segments_l; ++segment) {
-          int32_t size = size_recv[sort_rank * (num_segments_l + 1) + segment];
-          std::fill(p_segments + start_pos, p_segments + start_pos + size, segment);
-          start_pos += size;
-        }
-      }
-      assert(start_pos == total_receive);
-    }
-
-    merge_buffer.values  = create_buffer<VAL>(total_receive);
-    merge_buffer.indices = create_buffer<int64_t>(argsort ? total_receive : 0);
-    merge_buffer.size    = total_receive;
-  }
-
-  // communicate all2all (in sort dimension)
-  {
-    auto send_size_total = create_buffer<int32_t>(num_ranks);
-    auto recv_size_total = create_buffer<int32_t>(num_ranks);
-    std::fill(send_size_total.ptr(0), send_size_total.ptr(0) + num_ranks, 0);
-    std::fill(recv_size_total.ptr(0), recv_size_total.ptr(0) + num_ranks, 0);
-
-    auto sdispls = create_buffer<int32_t>(num_ranks);
-    auto rdispls = create_buffer<int32_t>(num_ranks);
-
-    for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-      send_size_total[sort_ranks[sort_rank]] =
-        sizeof(VAL) * size_send[sort_rank * (num_segments_l + 1) + num_segments_l];
-      recv_size_total[sort_ranks[sort_rank]] =
-        sizeof(VAL) * size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
-    }
-    auto p_send_size_total = send_size_total.ptr(0);
-    auto p_recv_size_total = recv_size_total.ptr(0);
-    thrust::exclusive_scan(
-      exec, p_send_size_total, p_send_size_total + num_ranks, sdispls.ptr(0), 0);
-    thrust::exclusive_scan(
-      exec, p_recv_size_total, p_recv_size_total + num_ranks, rdispls.ptr(0), 0);
-
-    comm::coll::collAlltoallv(val_send_buffer.ptr(0),
-                              send_size_total.ptr(0),
-                              sdispls.ptr(0),
-                              merge_buffer.values.ptr(0),
-                              recv_size_total.ptr(0),
-                              rdispls.ptr(0),
-                              comm::coll::CollDataType::CollUint8,
-                              comm);
-
-    if (argsort) {
-      for (size_t sort_rank = 0; sort_rank < num_sort_ranks; ++sort_rank) {
-        send_size_total[sort_ranks[sort_rank]] =
-          size_send[sort_rank * (num_segments_l + 1) + num_segments_l];
-        recv_size_total[sort_ranks[sort_rank]] =
-          size_recv[sort_rank * (num_segments_l + 1) + num_segments_l];
-      }
-
-      thrust::exclusive_scan(
-        exec, p_send_size_total, p_send_size_total + num_ranks, sdispls.ptr(0), 0);
-      thrust::exclusive_scan(
-        exec, p_recv_size_total, p_recv_size_total + num_ranks, rdispls.ptr(0), 0);
-      comm::coll::collAlltoallv(idc_send_buffer.ptr(0),
-                                send_size_total.ptr(0),
-                                sdispls.ptr(0),
-                                merge_buffer.indices.ptr(0),
-                                recv_size_total.ptr(0),
-                                rdispls.ptr(0),
-                                comm::coll::CollDataType::CollInt64,
-                                comm);
-    }
-
-    send_size_total.destroy();
-    recv_size_total.destroy();
-    sdispls.destroy();
-    rdispls.destroy();
-  }
+  SegmentMergePiece<VAL> merge_buffer = exchange_segment_pieces(size_send,
+                                                                val_send_buffer,
+                                                                idc_send_buffer,
+                                                                num_segments_l,
+                                                                num_ranks,
+                                                                num_sort_ranks,
+                                                                sort_ranks,
+                                                                argsort,
+                                                                exec,
+                                                                comm);
 
   // cleanup remaining buffers
   size_send.destroy();
-  size_recv.destroy();
   val_send_buffer.destroy();
   if (argsort) idc_send_buffer.destroy();
 
@@ -838,31 +1124,8 @@ void sample_sort_nd(SortPiece<legate_type_of<CODE>> local_sorted,
   /////////////// Part 4: merge data
   /////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // now merge sort all into the result buffer
-  if (merge_buffer.size > 0) {
-    // sort data (locally)
-    if (num_segments_l == 1) {
-      auto* p_values  = merge_buffer.values.ptr(0);
-      auto* p_indices = argsort ? merge_buffer.indices.ptr(0) : nullptr;
-      thrust_local_sort_inplace(
-        p_values, p_indices, merge_buffer.size, merge_buffer.size, true, exec);
-    } else {
-      // we need to consider segments as well
-      auto combined = thrust::make_zip_iterator(
-        thrust::make_tuple(merge_buffer.segments.ptr(0), merge_buffer.values.ptr(0)));
-      if (argsort) {
-        auto* p_indices = merge_buffer.indices.ptr(0);
-        thrust::stable_sort_by_key(exec,
-                                   combined,
-                                   combined + merge_buffer.size,
-                                   p_indices,
-                                   thrust::less<thrust::tuple<size_t, VAL>>());
-      } else {
-        thrust::stable_sort(
-          exec, combined, combined + merge_buffer.size, thrust::less<thrust::tuple<size_t, VAL>>());
-      }
-    }
-  }
+  // the received runs are already sorted, so they only need to be merged per segment
+  merge_sorted_runs(merge_buffer, num_segments_l, num_sort_ranks, argsort, exec);
 
   /////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////// Part 5: re-balance data to match input/output dimensions
@@ -17,76 +17,164 @@
 #include "cunumeric/stat/bincount.h"
 #include "cunumeric/stat/bincount_template.inl"
 
+#include <algorithm>
+#include <numeric>
 #include <omp.h>
 
 namespace cunumeric {
 
 using namespace legate;
 
-template <Type::Code CODE>
-struct BincountImplBody<VariantKind::OMP, CODE> {
-  using VAL = legate_type_of<CODE>;
+namespace {
+
+// The bins are counted in private copies per thread only while all the copies together hold no
+// more than this many bins or as many bins as there are values, whichever is larger. Beyond
+// that, the copies would take more memory and merging time than the input is worth.
+constexpr size_t PRIVATE_BINS_BUDGET = 1 << 22;
+
+// A partition of the bins is reduced by sorting its values when it has fewer than one value
+// for this many bins, which turns the scattered updates of the output into a single ordered
+// pass over the bins that are hit
+constexpr size_t SPARSE_BINS_RATIO = 16;
 
-  std::vector<std::vector<int64_t>> _bincount(const AccessorRO<VAL, 1>& rhs,
-                                              const Rect<1>& rect,
-                                              const Rect<1>& lhs_rect) const
+template <typename RES>
+struct BinEntry {
+  size_t bin;
+  RES weight;
+};
+
+// Every thread counts its share of the values into a private copy of the bins, and then the
+// copies are merged with each thread summing a contiguous range of the bins
+template <typename RES, typename VAL, typename Weight>
+void private_bincount(AccessorRD<SumReduction<RES>, true, 1>& lhs,
+                      const AccessorRO<VAL, 1>& rhs,
+                      const Rect<1>& rect,
+                      size_t num_bins,
+                      Weight weight)
+{
+  const size_t num_copies = omp_get_max_threads();
+  std::vector<RES> all_bins(num_bins * num_copies, SumReduction<RES>::identity);
+#pragma omp parallel
   {
-    const int max_threads   = omp_get_max_threads();
-    const size_t lhs_volume = lhs_rect.volume();
-    std::vector<std::vector<int64_t>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<int64_t>::identity;
-      local_bins = std::vector<int64_t>(lhs_volume, init);
+    RES* local_bins = all_bins.data() + omp_get_thread_num() * num_bins;
+#pragma omp for schedule(static)
+    for (coord_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
+      auto value = rhs[idx];
+      assert(0 <= value && static_cast<size_t>(value) < num_bins);
+      SumReduction<RES>::template fold<true>(local_bins[value], weight(idx));
     }
-#pragma omp parallel
-    {
-      auto tid                         = omp_get_thread_num();
-      std::vector<int64_t>& local_bins = all_local_bins[tid];
 #pragma omp for schedule(static)
-      for (size_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
-        auto value = rhs[idx];
-        assert(lhs_rect.contains(value));
-        SumReduction<int64_t>::fold<true>(local_bins[value], 1);
-      }
+    for (size_t bin = 0; bin < num_bins; ++bin) {
+      RES sum = SumReduction<RES>::identity;
+      for (size_t copy = 0; copy < num_copies; ++copy)
+        SumReduction<RES>::template fold<true>(sum, all_bins[copy * num_bins + bin]);
+      lhs.reduce(bin, sum);
     }
-    return std::move(all_local_bins);
   }
+}
+
+// The bins are split into one contiguous partition per thread. The values are first scattered
+// into buckets by partition, which takes one pass to count the bucket sizes and one to fill the
+// buckets, and then each thread reduces the bucket of its partition straight into the output.
+// No thread ever holds a copy of the bins, so the scratch space only depends on the input.
+template <typename RES, typename VAL, typename Weight>
+void partitioned_bincount(AccessorRD<SumReduction<RES>, true, 1>& lhs,
+                          const AccessorRO<VAL, 1>& rhs,
+                          const Rect<1>& rect,
+                          size_t num_bins,
+                          Weight weight)
+{
+  const size_t volume     = rect.volume();
+  const size_t num_parts  = omp_get_max_threads();
+  const size_t part_bins  = (num_bins + num_parts - 1) / num_parts;
+  const size_t chunk_size = (volume + num_parts - 1) / num_parts;
+
+  // offsets[part * num_parts + chunk + 1] first holds the number of values of the chunk that
+  // fall into the partition, and then the position of the chunk in the bucket of the partition
+  std::vector<size_t> offsets(num_parts * num_parts + 1, 0);
+  std::vector<BinEntry<RES>> entries(volume);
+
+  auto chunk_range = [&](size_t chunk) {
+    const size_t start = std::min(chunk * chunk_size, volume);
+    const size_t stop  = std::min(start + chunk_size, volume);
+    return std::make_pair(rect.lo[0] + static_cast<coord_t>(start),
+                          rect.lo[0] + static_cast<coord_t>(stop));
+  };
 
-  std::vector<std::vector<double>> _bincount(const AccessorRO<VAL, 1>& rhs,
-                                             const AccessorRO<double, 1>& weights,
-                                             const Rect<1>& rect,
-                                             const Rect<1>& lhs_rect) const
-  {
-    const int max_threads   = omp_get_max_threads();
-    const size_t lhs_volume = lhs_rect.volume();
-    std::vector<std::vector<double>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<double>::identity;
-      local_bins = std::vector<double>(lhs_volume, init);
-    }
 #pragma omp parallel
-    {
-      auto tid                        = omp_get_thread_num();
-      std::vector<double>& local_bins = all_local_bins[tid];
+  {
 #pragma omp for schedule(static)
-      for (size_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
+    for (size_t chunk = 0; chunk < num_parts; ++chunk) {
+      auto [lo, hi] = chunk_range(chunk);
+      for (coord_t idx = lo; idx < hi; ++idx) {
         auto value = rhs[idx];
-        assert(lhs_rect.contains(value));
-        SumReduction<double>::fold<true>(local_bins[value], weights[idx]);
+        assert(0 <= value && static_cast<size_t>(value) < num_bins);
+        ++offsets[static_cast<size_t>(value) / part_bins * num_parts + chunk + 1];
+      }
+    }
+#pragma omp single
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+#pragma omp for schedule(static)
+    for (size_t chunk = 0; chunk < num_parts; ++chunk) {
+      std::vector<size_t> positions(num_parts);
+      for (size_t part = 0; part < num_parts; ++part)
+        positions[part] = offsets[part * num_parts + chunk];
+      auto [lo, hi] = chunk_range(chunk);
+      for (coord_t idx = lo; idx < hi; ++idx) {
+        const size_t bin    = rhs[idx];
+        auto& position      = positions[bin / part_bins];
+        entries[position++] = BinEntry<RES>{bin, weight(idx)};
+      }
+    }
+#pragma omp for schedule(dynamic, 1)
+    for (size_t part = 0; part < num_parts; ++part) {
+      auto first = entries.begin() + offsets[part * num_parts];
+      auto last  = entries.begin() + offsets[(part + 1) * num_parts];
+      if (static_cast<size_t>(last - first) * SPARSE_BINS_RATIO < part_bins) {
+        std::sort(first, last, [](const auto& a, const auto& b) { return a.bin < b.bin; });
+        while (first != last) {
+          const size_t bin = first->bin;
+          RES sum          = SumReduction<RES>::identity;
+          for (; first != last && first->bin == bin; ++first)
+            SumReduction<RES>::template fold<true>(sum, first->weight);
+          lhs.reduce(bin, sum);
+        }
+      } else {
+        for (; first != last; ++first) lhs.reduce(first->bin, first->weight);
       }
     }
-    return std::move(all_local_bins);
   }
+}
+
+template <typename RES, typename VAL, typename Weight>
+void bincount(AccessorRD<SumReduction<RES>, true, 1>& lhs,
+              const AccessorRO<VAL, 1>& rhs,
+              const Rect<1>& rect,
+              const Rect<1>& lhs_rect,
+              Weight weight)
+{
+  // The output is never partitioned, so the bins are indexed by the values themselves
+  assert(lhs_rect.lo[0] == 0);
+  const size_t num_bins = lhs_rect.volume();
+  const size_t budget   = std::max(rect.volume(), PRIVATE_BINS_BUDGET);
+  if (num_bins * omp_get_max_threads() <= budget)
+    private_bincount<RES>(lhs, rhs, rect, num_bins, weight);
+  else
+    partitioned_bincount<RES>(lhs, rhs, rect, num_bins, weight);
+}
+
+}  // namespace
+
+template <Type::Code CODE>
+struct BincountImplBody<VariantKind::OMP, CODE> {
+  using VAL = legate_type_of<CODE>;
 
   void operator()(AccessorRD<SumReduction<int64_t>, true, 1> lhs,
                   const AccessorRO<VAL, 1>& rhs,
                   const Rect<1>& rect,
                   const Rect<1>& lhs_rect) const
   {
-    auto all_local_bins = _bincount(rhs, rect, lhs_rect);
-    for (auto& local_bins : all_local_bins)
-      for (size_t bin_num = 0; bin_num < local_bins.size(); ++bin_num)
-        lhs.reduce(bin_num, local_bins[bin_num]);
+    bincount<int64_t>(lhs, rhs, rect, lhs_rect, [](coord_t) { return int64_t{1}; });
   }
 
   void operator()(AccessorRD<SumReduction<double>, true, 1> lhs,
@@ -95,10 +183,7 @@ struct BincountImplBody<VariantKind::OMP, CODE> {
                   const Rect<1>& rect,
                   const Rect<1>& lhs_rect) const
   {
-    auto all_local_bins = _bincount(rhs, weights, rect, lhs_rect);
-    for (auto& local_bins : all_local_bins)
-      for (size_t bin_num = 0; bin_num < local_bins.size(); ++bin_num)
-        lhs.reduce(bin_num, local_bins[bin_num]);
+    bincount<double>(lhs, rhs, rect, lhs_rect, [&](coord_t idx) { return weights[idx]; });
   }
 };
 
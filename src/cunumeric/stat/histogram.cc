@@ -60,6 +60,28 @@ struct HistogramImplBody<VariantKind::CPU, CODE> {
     detail::histogram_wrapper(
       exe_pol, src, src_rect, bins, bins_rect, weights, weights_rect, result, result_rect);
   }
+
+  // With equally spaced bins, the bin of each value is computed in constant time, which
+  // avoids sorting a copy of the values and weights
+  void operator()(UniformBins,
+                  const AccessorRO<VAL, 1>& src,
+                  const Rect<1>& src_rect,
+                  const AccessorRO<BinType, 1>& bins,
+                  const Rect<1>& bins_rect,
+                  const AccessorRO<WeightType, 1>& weights,
+                  const Rect<1>& weights_rect,
+                  const AccessorRD<SumReduction<WeightType>, true, 1>& result,
+                  const Rect<1>& result_rect) const
+  {
+    auto&& [bins_size, bins_ptr] = detail::accessors::get_accessor_ptr(bins, bins_rect);
+    const size_t num_intervals   = bins_size - 1;
+    const BinType inv_width      = num_intervals / (bins_ptr[num_intervals] - bins_ptr[0]);
+
+    for (coord_t idx = src_rect.lo[0]; idx <= src_rect.hi[0]; ++idx) {
+      auto bin = detail::uniform_bin_index(src[idx], bins_ptr, num_intervals, inv_width);
+      if (bin >= 0) result.reduce(result_rect.lo[0] + bin, weights[idx]);
+    }
+  }
 };
 
 /*static*/ void HistogramTask::cpu_variant(TaskContext& context)
@@ -25,6 +25,7 @@ struct HistogramArgs {
   const Array& src;
   const Array& bins;
   const Array& weights;
+  bool uniform;
 };
 
 class HistogramTask : public CuNumericTask<HistogramTask> {
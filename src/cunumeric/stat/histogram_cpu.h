@@ -81,6 +81,23 @@ struct segmented_sum_t<exe_policy_t,
   offset_t* ptr_offsets_{nullptr};
 };
 
+// Returns the bin of `value` among the equally spaced `n_intervals` bins whose edges are in
+// `p_bins`, or -1 if the value falls outside of them. The bin is computed arithmetically and
+// then corrected against the edges themselves, as NumPy does, so that rounding never puts a
+// value on the wrong side of an edge. Like with the other bins, the last one is closed.
+template <typename elem_t, typename bin_t>
+int64_t uniform_bin_index(elem_t value, bin_t const* p_bins, size_t n_intervals, bin_t inv_width)
+{
+  auto x = static_cast<bin_t>(value);
+  if (!(x >= p_bins[0] && x <= p_bins[n_intervals])) return -1;
+  auto index = std::min(static_cast<size_t>((x - p_bins[0]) * inv_width), n_intervals - 1);
+  if (x < p_bins[index])
+    --index;
+  else if (index + 1 < n_intervals && x >= p_bins[index + 1])
+    ++index;
+  return static_cast<int64_t>(index);
+}
+
 template <typename exe_policy_t>
 struct sync_policy_t<exe_policy_t, std::enable_if_t<is_host_policy_v<exe_policy_t>>> {
   sync_policy_t(void) {}
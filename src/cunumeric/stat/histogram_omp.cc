@@ -29,10 +29,26 @@
 #include <algorithm>
 #include <numeric>
 #include <tuple>
+#include <vector>
 
 namespace cunumeric {
 using namespace legate;
 
+namespace {
+
+// The bins of uniform histograms are counted in private copies per thread only while all the
+// copies together hold no more than this many bins or as many bins as there are values,
+// whichever is larger. Beyond that, the bins are partitioned among the threads instead.
+constexpr size_t PRIVATE_BINS_BUDGET = 1 << 22;
+
+template <typename WeightType>
+struct HistogramEntry {
+  size_t bin;
+  WeightType weight;
+};
+
+}  // namespace
+
 template <Type::Code CODE>
 struct HistogramImplBody<VariantKind::OMP, CODE> {
   using VAL = legate_type_of<CODE>;
@@ -111,6 +127,138 @@ struct HistogramImplBody<VariantKind::OMP, CODE> {
     }
 #endif
   }
+
+  // With equally spaced bins, the bin of each value is computed in constant time. Every
+  // thread counts into a private copy of the bins, and the copies are then merged with each
+  // thread summing a range of the bins. When the copies would take too much memory, the bins
+  // are split into one contiguous partition per thread instead, as bincount does.
+  void operator()(UniformBins,
+                  const AccessorRO<VAL, 1>& src,
+                  const Rect<1>& src_rect,
+                  const AccessorRO<BinType, 1>& bins,
+                  const Rect<1>& bins_rect,
+                  const AccessorRO<WeightType, 1>& weights,
+                  const Rect<1>& weights_rect,
+                  const AccessorRD<SumReduction<WeightType>, true, 1>& result,
+                  const Rect<1>& result_rect) const
+  {
+    auto&& [bins_size, bins_ptr] = detail::accessors::get_accessor_ptr(bins, bins_rect);
+    const size_t num_intervals   = bins_size - 1;
+    const BinType* edges         = bins_ptr;
+    const BinType inv_width      = num_intervals / (edges[num_intervals] - edges[0]);
+    auto bin_of                  = [&](coord_t idx) {
+      return detail::uniform_bin_index(src[idx], edges, num_intervals, inv_width);
+    };
+
+    const size_t budget = std::max(src_rect.volume(), PRIVATE_BINS_BUDGET);
+    if (num_intervals * omp_get_max_threads() <= budget)
+      private_histogram(src_rect, weights, result, result_rect, num_intervals, bin_of);
+    else
+      partitioned_histogram(src_rect, weights, result, result_rect, num_intervals, bin_of);
+  }
+
+ private:
+  template <typename BinOf>
+  static void private_histogram(const Rect<1>& src_rect,
+                                const AccessorRO<WeightType, 1>& weights,
+                                const AccessorRD<SumReduction<WeightType>, true, 1>& result,
+                                const Rect<1>& result_rect,
+                                size_t num_intervals,
+                                BinOf&& bin_of)
+  {
+    const size_t num_copies = omp_get_max_threads();
+    auto all_local_results  = create_buffer<WeightType>(num_intervals * num_copies);
+    WeightType* p_results   = all_local_results.ptr(0);
+#pragma omp parallel
+    {
+      WeightType* local_result = p_results + omp_get_thread_num() * num_intervals;
+      std::fill(local_result, local_result + num_intervals, WeightType{0});
+#pragma omp barrier
+#pragma omp for schedule(static)
+      for (coord_t idx = src_rect.lo[0]; idx <= src_rect.hi[0]; ++idx) {
+        auto bin = bin_of(idx);
+        if (bin >= 0) local_result[bin] += weights[idx];
+      }
+#pragma omp for schedule(static)
+      for (size_t bin = 0; bin < num_intervals; ++bin) {
+        WeightType sum = 0;
+        for (size_t copy = 0; copy < num_copies; ++copy)
+          sum += p_results[copy * num_intervals + bin];
+        result.reduce(result_rect.lo[0] + bin, sum);
+      }
+    }
+    all_local_results.destroy();
+  }
+
+  // The values are scattered into buckets by partition of the bins, which takes one pass to
+  // count the bucket sizes and one to fill the buckets. Each thread then reduces the bucket of
+  // its partition straight into the result, so no thread ever holds a copy of the bins.
+  template <typename BinOf>
+  static void partitioned_histogram(const Rect<1>& src_rect,
+                                    const AccessorRO<WeightType, 1>& weights,
+                                    const AccessorRD<SumReduction<WeightType>, true, 1>& result,
+                                    const Rect<1>& result_rect,
+                                    size_t num_intervals,
+                                    BinOf&& bin_of)
+  {
+    const size_t volume     = src_rect.volume();
+    const size_t num_parts  = omp_get_max_threads();
+    const size_t part_bins  = (num_intervals + num_parts - 1) / num_parts;
+    const size_t chunk_size = (volume + num_parts - 1) / num_parts;
+
+    // offsets[part * num_parts + chunk + 1] first holds the number of values of the chunk that
+    // fall into the partition, and then the position of the chunk in the bucket of the partition
+    auto offsets      = create_buffer<size_t>(num_parts * num_parts + 1);
+    auto bin_indices  = create_buffer<int64_t>(std::max<size_t>(volume, 1));
+    auto entries      = create_buffer<HistogramEntry<WeightType>>(std::max<size_t>(volume, 1));
+    size_t* p_offsets = offsets.ptr(0);
+    int64_t* p_bins   = bin_indices.ptr(0);
+    auto* p_entries   = entries.ptr(0);
+    std::fill(p_offsets, p_offsets + num_parts * num_parts + 1, 0);
+
+    auto chunk_range = [&](size_t chunk) {
+      const size_t start = std::min(chunk * chunk_size, volume);
+      return std::make_pair(start, std::min(start + chunk_size, volume));
+    };
+
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+      for (size_t chunk = 0; chunk < num_parts; ++chunk) {
+        auto [lo, hi] = chunk_range(chunk);
+        for (size_t pos = lo; pos < hi; ++pos) {
+          p_bins[pos] = bin_of(src_rect.lo[0] + static_cast<coord_t>(pos));
+          if (p_bins[pos] >= 0) ++p_offsets[p_bins[pos] / part_bins * num_parts + chunk + 1];
+        }
+      }
+#pragma omp single
+      std::partial_sum(p_offsets, p_offsets + num_parts * num_parts + 1, p_offsets);
+#pragma omp for schedule(static)
+      for (size_t chunk = 0; chunk < num_parts; ++chunk) {
+        std::vector<size_t> positions(num_parts);
+        for (size_t part = 0; part < num_parts; ++part)
+          positions[part] = p_offsets[part * num_parts + chunk];
+        auto [lo, hi] = chunk_range(chunk);
+        for (size_t pos = lo; pos < hi; ++pos) {
+          if (p_bins[pos] < 0) continue;
+          const size_t bin = p_bins[pos];
+          p_entries[positions[bin / part_bins]++] = HistogramEntry<WeightType>{
+            bin, weights[src_rect.lo[0] + static_cast<coord_t>(pos)]};
+        }
+      }
+#pragma omp for schedule(static, 1)
+      for (size_t part = 0; part < num_parts; ++part) {
+        const size_t first = p_offsets[part * num_parts];
+        const size_t last  = p_offsets[(part + 1) * num_parts];
+        for (size_t pos = first; pos < last; ++pos)
+          result.reduce(result_rect.lo[0] + p_entries[pos].bin, p_entries[pos].weight);
+      }
+    }
+
+    offsets.destroy();
+    bin_indices.destroy();
+    entries.destroy();
+  }
 };
 
 /*static*/ void HistogramTask::omp_variant(TaskContext& context)
@@ -26,6 +26,10 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE>
 struct HistogramImplBody;
 
+// Selects the bodies of the host variants that compute the bin of each value from equally
+// spaced bins, which the GPU variant doesn't have
+struct UniformBins {};
+
 template <Type::Code CODE>
 inline constexpr bool is_candidate = (is_floating_point<CODE>::value || is_integral<CODE>::value);
 
@@ -53,6 +57,21 @@ struct HistogramImpl {
     auto bins    = args.bins.read_accessor<BinType, 1>(bins_rect);
     auto weights = args.weights.read_accessor<WeightType, 1>(weights_rect);
 
+    if constexpr (KIND != VariantKind::GPU) {
+      // Uniform bins collapse when all the values are the same
+      if (args.uniform && bins[bins_rect.hi] > bins[bins_rect.lo]) {
+        HistogramImplBody<KIND, CODE>()(UniformBins{},
+                                        src,
+                                        src_rect,
+                                        bins,
+                                        bins_rect,
+                                        weights,
+                                        weights_rect,
+                                        result,
+                                        result_rect);
+        return;
+      }
+    }
     HistogramImplBody<KIND, CODE>()(
       src, src_rect, bins, bins_rect, weights, weights_rect, result, result_rect);
   }
@@ -69,7 +88,8 @@ static void histogram_template(TaskContext& context)
 {
   auto& inputs     = context.inputs();
   auto& reductions = context.reductions();
-  HistogramArgs args{reductions[0], inputs[0], inputs[1], inputs[2]};
+  auto& scalars    = context.scalars();
+  HistogramArgs args{reductions[0], inputs[0], inputs[1], inputs[2], scalars[0].value<bool>()};
   type_dispatch(args.src.code(), HistogramImpl<KIND>{}, args);
 }
 
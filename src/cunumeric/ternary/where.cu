@@ -21,13 +21,14 @@
 
 namespace cunumeric {
 
-template <typename VAL>
+// Scalar inputs are passed by their pointers, as their values live in device memory
+template <bool SCALAR_IN1, bool SCALAR_IN2, typename VAL>
 static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   dense_kernel(size_t volume, VAL* out, const bool* mask, const VAL* in1, const VAL* in2)
 {
   const size_t idx = global_tid_1d();
   if (idx >= volume) return;
-  out[idx] = mask[idx] ? in1[idx] : in2[idx];
+  out[idx] = mask[idx] ? in1[SCALAR_IN1 ? 0 : idx] : in2[SCALAR_IN2 ? 0 : idx];
 }
 
 template <typename WriteAcc, typename MaskAcc, typename ReadAcc, typename Pitches, typename Rect>
@@ -50,19 +51,28 @@ struct WhereImplBody<VariantKind::GPU, CODE, DIM> {
                   AccessorRO<VAL, DIM> in2,
                   const Pitches<DIM - 1>& pitches,
                   const Rect<DIM>& rect,
-                  bool dense) const
+                  WhereLayout layout) const
   {
     const size_t volume = rect.volume();
     const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
     auto stream         = get_cached_stream();
-    if (dense) {
-      size_t volume = rect.volume();
-      auto outptr   = out.ptr(rect);
-      auto maskptr  = mask.ptr(rect);
-      auto in1ptr   = in1.ptr(rect);
-      auto in2ptr   = in2.ptr(rect);
-      dense_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
-        volume, outptr, maskptr, in1ptr, in2ptr);
+    if (layout != WhereLayout::STRIDED) {
+      auto outptr  = out.ptr(rect);
+      auto maskptr = mask.ptr(rect);
+      auto in1ptr  = in1.ptr(rect.lo);
+      auto in2ptr  = in2.ptr(rect.lo);
+      if (layout == WhereLayout::DENSE)
+        dense_kernel<false, false><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          volume, outptr, maskptr, in1ptr, in2ptr);
+      else if (layout == WhereLayout::SCALAR_IN1)
+        dense_kernel<true, false><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          volume, outptr, maskptr, in1ptr, in2ptr);
+      else if (layout == WhereLayout::SCALAR_IN2)
+        dense_kernel<false, true><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          volume, outptr, maskptr, in1ptr, in2ptr);
+      else
+        dense_kernel<true, true><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          volume, outptr, maskptr, in1ptr, in2ptr);
     } else {
       generic_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
         volume, out, mask, in1, in2, pitches, rect);
@@ -20,6 +20,16 @@
 
 namespace cunumeric {
 
+// Operand layouts that the task bodies have their own loops for. As with binary operations,
+// scalar inputs (e.g., in `where(mask, x, 0)`) are loaded once instead of read per point.
+enum class WhereLayout : int {
+  DENSE         = 0,  // All operands are dense
+  SCALAR_IN1    = 1,  // The first input is a scalar and the other operands are dense
+  SCALAR_IN2    = 2,  // The second input is a scalar and the other operands are dense
+  SCALAR_INPUTS = 3,  // Both inputs are scalars and the output and the mask are dense
+  STRIDED       = 4,  // Anything else
+};
+
 struct WhereArgs {
   const Array& out;
   const Array& mask;
@@ -16,6 +16,7 @@
 
 #include "cunumeric/ternary/where.h"
 #include "cunumeric/ternary/where_template.inl"
+#include "cunumeric/omp_help.h"
 
 namespace cunumeric {
 
@@ -31,24 +32,49 @@ struct WhereImplBody<VariantKind::OMP, CODE, DIM> {
                   AccessorRO<VAL, DIM> in2,
                   const Pitches<DIM - 1>& pitches,
                   const Rect<DIM>& rect,
-                  bool dense) const
+                  WhereLayout layout) const
   {
     const size_t volume = rect.volume();
-    if (dense) {
-      size_t volume = rect.volume();
-      auto outptr   = out.ptr(rect);
-      auto maskptr  = mask.ptr(rect);
-      auto in1ptr   = in1.ptr(rect);
-      auto in2ptr   = in2.ptr(rect);
+    if (layout == WhereLayout::STRIDED) {
+      const size_t out_stride  = inner_stride(out, rect);
+      const size_t mask_stride = inner_stride(mask, rect);
+      const size_t in1_stride  = inner_stride(in1, rect);
+      const size_t in2_stride  = inner_stride(in2, rect);
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& point, size_t count) {
+        auto outptr  = out.ptr(point);
+        auto maskptr = mask.ptr(point);
+        auto in1ptr  = in1.ptr(point);
+        auto in2ptr  = in2.ptr(point);
+        for (size_t idx = 0; idx < count; ++idx)
+          outptr[idx * out_stride] =
+            maskptr[idx * mask_stride] ? in1ptr[idx * in1_stride] : in2ptr[idx * in2_stride];
+      });
+      return;
+    }
+
+    auto outptr  = out.ptr(rect);
+    auto maskptr = mask.ptr(rect);
+    if (layout == WhereLayout::DENSE) {
+      auto in1ptr = in1.ptr(rect);
+      auto in2ptr = in2.ptr(rect);
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx)
         outptr[idx] = maskptr[idx] ? in1ptr[idx] : in2ptr[idx];
+    } else if (layout == WhereLayout::SCALAR_IN1) {
+      const VAL in1val = in1[rect.lo];
+      auto in2ptr      = in2.ptr(rect);
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = maskptr[idx] ? in1val : in2ptr[idx];
+    } else if (layout == WhereLayout::SCALAR_IN2) {
+      auto in1ptr      = in1.ptr(rect);
+      const VAL in2val = in2[rect.lo];
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = maskptr[idx] ? in1ptr[idx] : in2val;
     } else {
+      const VAL in1val = in1[rect.lo];
+      const VAL in2val = in2[rect.lo];
 #pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto point = pitches.unflatten(idx, rect.lo);
-        out[point] = mask[point] ? in1[point] : in2[point];
-      }
+      for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = maskptr[idx] ? in1val : in2val;
     }
   }
 };
@@ -18,6 +18,7 @@
 
 // Useful for IDEs
 #include "cunumeric/ternary/where.h"
+#include "cunumeric/nd_iterator.h"
 #include "cunumeric/pitches.h"
 
 namespace cunumeric {
@@ -46,16 +47,27 @@ struct WhereImpl {
     auto in1  = args.in1.read_accessor<VAL, DIM>(rect);
     auto in2  = args.in2.read_accessor<VAL, DIM>(rect);
 
+    // Check to see if this is dense or not, where inputs broadcast from scalars count as
+    // dense. No dense execution if we're doing bounds checks.
+    auto layout = WhereLayout::STRIDED;
 #ifndef LEGATE_BOUNDS_CHECKS
-    // Check to see if this is dense or not
-    bool dense = out.accessor.is_dense_row_major(rect) && in1.accessor.is_dense_row_major(rect) &&
-                 in2.accessor.is_dense_row_major(rect) && mask.accessor.is_dense_row_major(rect);
-#else
-    // No dense execution if we're doing bounds checks
-    bool dense = false;
+    if (out.accessor.is_dense_row_major(rect) && mask.accessor.is_dense_row_major(rect)) {
+      bool in1_dense  = in1.accessor.is_dense_row_major(rect);
+      bool in2_dense  = in2.accessor.is_dense_row_major(rect);
+      bool in1_scalar = !in1_dense && is_scalar_broadcast(in1, rect);
+      bool in2_scalar = !in2_dense && is_scalar_broadcast(in2, rect);
+      if (in1_dense && in2_dense)
+        layout = WhereLayout::DENSE;
+      else if (in1_scalar && in2_dense)
+        layout = WhereLayout::SCALAR_IN1;
+      else if (in1_dense && in2_scalar)
+        layout = WhereLayout::SCALAR_IN2;
+      else if (in1_scalar && in2_scalar)
+        layout = WhereLayout::SCALAR_INPUTS;
+    }
 #endif
 
-    WhereImplBody<KIND, CODE, DIM>()(out, mask, in1, in2, pitches, rect, dense);
+    WhereImplBody<KIND, CODE, DIM>()(out, mask, in1, in2, pitches, rect, layout);
   }
 };
 
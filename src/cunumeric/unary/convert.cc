@@ -16,6 +16,7 @@
 
 #include "cunumeric/unary/convert.h"
 #include "cunumeric/unary/convert_template.inl"
+#include "cunumeric/nd_iterator.h"
 
 namespace cunumeric {
 
@@ -40,10 +41,14 @@ struct ConvertImplBody<VariantKind::CPU, NAN_OP, DST_TYPE, SRC_TYPE, DIM> {
       auto inptr  = in.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      for_each_row(rect, pitches, 0, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          outptr[idx * out_stride] = func(inptr[idx * in_stride]);
+      });
     }
   }
 };
@@ -16,6 +16,7 @@
 
 #include "cunumeric/unary/convert.h"
 #include "cunumeric/unary/convert_template.inl"
+#include "cunumeric/omp_help.h"
 
 namespace cunumeric {
 
@@ -41,11 +42,14 @@ struct ConvertImplBody<VariantKind::OMP, NAN_OP, DST_TYPE, SRC_TYPE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          outptr[idx * out_stride] = func(inptr[idx * in_stride]);
+      });
     }
   }
 };
@@ -47,7 +47,6 @@ struct ScalarUnaryRed {
   Point<DIM> origin;
   Point<DIM> shape;
   RHS to_find;
-  RHS mu;
   bool dense;
   WHERE where;
   const bool* whereptr;
@@ -55,6 +54,11 @@ struct ScalarUnaryRed {
   struct DenseReduction {};
   struct SparseReduction {};
 
+  // ALL is settled by the first false value and ANY and CONTAINS by the first true one
+  static constexpr bool EARLY_EXIT = OP_CODE == UnaryRedCode::ALL ||
+                                     OP_CODE == UnaryRedCode::ANY ||
+                                     OP_CODE == UnaryRedCode::CONTAINS;
+
   ScalarUnaryRed(ScalarUnaryRedArgs& args) : dense(false)
   {
     rect   = args.in.shape<DIM>();
@@ -65,7 +69,6 @@ struct ScalarUnaryRed {
 
     out = args.out.reduce_accessor<LG_OP, true, 1>();
     if constexpr (OP_CODE == UnaryRedCode::CONTAINS) { to_find = args.args[0].scalar<RHS>(); }
-    if constexpr (OP_CODE == UnaryRedCode::VARIANCE) { mu = args.args[0].scalar<RHS>(); }
 
     if constexpr (HAS_WHERE) where = args.where.read_accessor<bool, DIM>(rect);
 #ifndef LEGATE_BOUNDS_CHECKS
@@ -92,8 +95,6 @@ struct ScalarUnaryRed {
                          OP_CODE == UnaryRedCode::NANARGMAX || OP_CODE == UnaryRedCode::NANARGMIN) {
       auto p = pitches.unflatten(idx, origin);
       if (mask) OP::template fold<true>(lhs, OP::convert(p, shape, identity, inptr[idx]));
-    } else if constexpr (OP_CODE == UnaryRedCode::VARIANCE) {
-      if (mask) OP::template fold<true>(lhs, OP::convert(inptr[idx] - mu, identity));
     } else {
       if (mask) OP::template fold<true>(lhs, OP::convert(inptr[idx], identity));
     }
@@ -110,13 +111,19 @@ struct ScalarUnaryRed {
     } else if constexpr (OP_CODE == UnaryRedCode::ARGMAX || OP_CODE == UnaryRedCode::ARGMIN ||
                          OP_CODE == UnaryRedCode::NANARGMAX || OP_CODE == UnaryRedCode::NANARGMIN) {
       if (mask) OP::template fold<true>(lhs, OP::convert(p, shape, identity, in[p]));
-    } else if constexpr (OP_CODE == UnaryRedCode::VARIANCE) {
-      if (mask) OP::template fold<true>(lhs, OP::convert(in[p] - mu, identity));
     } else {
       if (mask) OP::template fold<true>(lhs, OP::convert(in[p], identity));
     }
   }
 
+  __CUDA_HD__ bool decided(const LHS& lhs) const noexcept
+  {
+    if constexpr (OP_CODE == UnaryRedCode::ALL)
+      return !lhs;
+    else
+      return static_cast<bool>(lhs);
+  }
+
   void execute() const noexcept
   {
     auto identity = LG_OP::identity;
@@ -16,6 +16,8 @@
 
 #include "cunumeric/unary/unary_op.h"
 #include "cunumeric/unary/unary_op_template.inl"
+#include "cunumeric/nd_iterator.h"
+#include "cunumeric/unary/vector_math.h"
 
 namespace cunumeric {
 
@@ -38,12 +40,22 @@ struct UnaryOpImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
     if (dense) {
       auto outptr = out.ptr(rect);
       auto inptr  = in.ptr(rect);
+      if constexpr (VectorUnaryOp<OP_CODE, CODE>::valid) {
+        if (vector_math::enabled()) {
+          VectorUnaryOp<OP_CODE, CODE>::apply(inptr, outptr, volume);
+          return;
+        }
+      }
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      for_each_row(rect, pitches, 0, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          outptr[idx * out_stride] = func(inptr[idx * in_stride]);
+      });
     }
   }
 };
@@ -62,10 +74,13 @@ struct PointCopyImplBody<VariantKind::CPU, VAL, DIM> {
       auto inptr  = in.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = inptr[idx];
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = in[p];
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      for_each_row(rect, pitches, 0, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx) outptr[idx * out_stride] = inptr[idx * in_stride];
+      });
     }
   }
 };
@@ -92,10 +107,16 @@ struct MultiOutUnaryOpImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
       auto rhs2ptr = rhs2.ptr(rect);
       for (size_t idx = 0; idx < volume; ++idx) lhsptr[idx] = func(rhs1ptr[idx], &rhs2ptr[idx]);
     } else {
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        lhs[p] = func(rhs1[p], rhs2.ptr(p));
-      }
+      const size_t lhs_stride  = inner_stride(lhs, rect);
+      const size_t rhs1_stride = inner_stride(rhs1, rect);
+      const size_t rhs2_stride = inner_stride(rhs2, rect);
+      for_each_row(rect, pitches, 0, volume, [&](const Point<DIM>& p, size_t count) {
+        auto lhsptr  = lhs.ptr(p);
+        auto rhs1ptr = rhs1.ptr(p);
+        auto rhs2ptr = rhs2.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          lhsptr[idx * lhs_stride] = func(rhs1ptr[idx * rhs1_stride], &rhs2ptr[idx * rhs2_stride]);
+      });
     }
   }
 };
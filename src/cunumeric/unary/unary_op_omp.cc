@@ -16,6 +16,8 @@
 
 #include "cunumeric/unary/unary_op.h"
 #include "cunumeric/unary/unary_op_template.inl"
+#include "cunumeric/omp_help.h"
+#include "cunumeric/unary/vector_math.h"
 
 namespace cunumeric {
 
@@ -38,14 +40,28 @@ struct UnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
     if (dense) {
       auto outptr = out.ptr(rect);
       auto inptr  = in.ptr(rect);
+      if constexpr (VectorUnaryOp<OP_CODE, CODE>::valid) {
+        if (vector_math::enabled()) {
+          // Each thread runs the vectorized kernel on a contiguous chunk
+#pragma omp parallel
+          {
+            auto [start, stop] = thread_range(volume);
+            VectorUnaryOp<OP_CODE, CODE>::apply(inptr + start, outptr + start, stop - start);
+          }
+          return;
+        }
+      }
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = func(in[p]);
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          outptr[idx * out_stride] = func(inptr[idx * in_stride]);
+      });
     }
   }
 };
@@ -65,11 +81,13 @@ struct PointCopyImplBody<VariantKind::OMP, VAL, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = inptr[idx];
     } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        out[p] = in[p];
-      }
+      const size_t out_stride = inner_stride(out, rect);
+      const size_t in_stride  = inner_stride(in, rect);
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& p, size_t count) {
+        auto outptr = out.ptr(p);
+        auto inptr  = in.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx) outptr[idx * out_stride] = inptr[idx * in_stride];
+      });
     }
   }
 };
@@ -97,11 +115,16 @@ struct MultiOutUnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) lhsptr[idx] = func(rhs1ptr[idx], &rhs2ptr[idx]);
     } else {
-#pragma omp parallel for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        auto p = pitches.unflatten(idx, rect.lo);
-        lhs[p] = func(rhs1[p], rhs2.ptr(p));
-      }
+      const size_t lhs_stride  = inner_stride(lhs, rect);
+      const size_t rhs1_stride = inner_stride(rhs1, rect);
+      const size_t rhs2_stride = inner_stride(rhs2, rect);
+      parallel_for_each_row(rect, pitches, volume, [&](const Point<DIM>& p, size_t count) {
+        auto lhsptr  = lhs.ptr(p);
+        auto rhs1ptr = rhs1.ptr(p);
+        auto rhs2ptr = rhs2.ptr(p);
+        for (size_t idx = 0; idx < count; ++idx)
+          lhsptr[idx * lhs_stride] = func(rhs1ptr[idx * rhs1_stride], &rhs2ptr[idx * rhs2_stride]);
+      });
     }
   }
 };
@@ -168,7 +168,9 @@ struct UnaryOpDispatch {
       auto& type = static_cast<const FixedArrayType&>(args.in.type());
       cunumeric::double_dispatch(dim, type.num_elements(), UnaryCopyImpl<KIND>{}, args);
     } else {
-      auto code = OP_CODE == UnaryOpCode::GETARG ? args.out.code() : args.in.code();
+      auto code = OP_CODE == UnaryOpCode::GETARG || OP_CODE == UnaryOpCode::GETVAR
+                    ? args.out.code()
+                    : args.in.code();
       legate::double_dispatch(dim, code, UnaryOpImpl<KIND, OP_CODE>{}, args);
     }
   }
@@ -19,6 +19,7 @@
 #include "cunumeric/cunumeric.h"
 #include "cunumeric/arg.h"
 #include "cunumeric/arg.inl"
+#include "cunumeric/welford.h"
 
 #define _USE_MATH_DEFINES
 
@@ -49,6 +50,7 @@ enum class UnaryOpCode : int {
   FLOOR       = CUNUMERIC_UOP_FLOOR,
   FREXP       = CUNUMERIC_UOP_FREXP,
   GETARG      = CUNUMERIC_UOP_GETARG,
+  GETVAR      = CUNUMERIC_UOP_GETVAR,
   IMAG        = CUNUMERIC_UOP_IMAG,
   INVERT      = CUNUMERIC_UOP_INVERT,
   ISFINITE    = CUNUMERIC_UOP_ISFINITE,
@@ -121,6 +123,8 @@ constexpr decltype(auto) op_dispatch(UnaryOpCode op_code, Functor f, Fnargs&&...
       return f.template operator()<UnaryOpCode::FLOOR>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::GETARG:
       return f.template operator()<UnaryOpCode::GETARG>(std::forward<Fnargs>(args)...);
+    case UnaryOpCode::GETVAR:
+      return f.template operator()<UnaryOpCode::GETVAR>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::IMAG:
       return f.template operator()<UnaryOpCode::IMAG>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::INVERT:
@@ -631,6 +635,30 @@ struct UnaryOp<UnaryOpCode::GETARG, CODE> {
   constexpr decltype(auto) operator()(const T& x) const { return x.arg; }
 };
 
+template <legate::Type::Code CODE>
+struct UnaryOp<UnaryOpCode::GETVAR, CODE> {
+  using VAL                   = legate::legate_type_of<CODE>;
+  using T                     = WelfordState<VAL>;
+  static constexpr bool valid =
+    CODE == legate::Type::Code::FLOAT32 || CODE == legate::Type::Code::FLOAT64;
+
+  UnaryOp(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 1);
+    ddof = args[0].scalar<int64_t>();
+  }
+
+  // As in NumPy, the divisor is clamped at zero, which gives inf or nan
+  // when the degrees of freedom are exhausted
+  constexpr VAL operator()(const T& x) const
+  {
+    int64_t divisor = x.count > ddof ? x.count - ddof : 0;
+    return x.m2 / static_cast<VAL>(divisor);
+  }
+
+  int64_t ddof;
+};
+
 template <legate::Type::Code CODE>
 struct UnaryOp<UnaryOpCode::IMAG, CODE> {
   using T                     = legate::legate_type_of<CODE>;
@@ -33,6 +33,7 @@ struct UnaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
+                  uint32_t collapsed_mask,
                   size_t volume) const
   {
     for (size_t idx = 0; idx < volume; ++idx) {
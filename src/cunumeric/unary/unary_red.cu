@@ -324,11 +324,15 @@ struct UnaryRedImplBody<VariantKind::GPU, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
+                  uint32_t collapsed_mask,
                   size_t volume) const
   {
     auto Kernel = reduce_with_rd_acc<OP, LG_OP, LHS, RHS, DIM, HAS_WHERE>;
     auto stream = get_cached_stream();
 
+    // Threads iterate over the innermost collapsed dimension only. Any other collapsed
+    // dimensions are distributed across threads like the surviving ones, which is safe
+    // because the reduction accessor folds into the output atomically.
     ThreadBlocks<DIM> blocks;
     blocks.initialize(rect, collapsed_dim);
 
@@ -25,7 +25,9 @@ struct UnaryRedArgs {
   const Array& lhs;
   const Array& rhs;
   const Array& where;
-  int32_t collapsed_dim;
+  // Dimensions being collapsed, in ascending order. Argument reductions
+  // always collapse a single dimension.
+  legate::Span<const int32_t> collapsed_dims;
   UnaryRedCode op_code;
 };
 
@@ -26,13 +26,18 @@ struct Split {
   size_t inner{0};
 };
 
+// Splits a rectangle into an outer dimension, which is distributed across threads,
+// and the remaining inner dimensions. Dimensions in `inner_mask` are never picked as
+// the outer one so that threads reduce into disjoint sets of points. When all
+// dimensions are in the mask, the whole rectangle becomes a single inner range.
 template <int DIM>
 class Splitter {
  public:
-  Split split(const Rect<DIM>& rect, int must_be_inner)
+  Split split(const Rect<DIM>& rect, uint32_t inner_mask)
   {
+    outer_dim_ = -1;
     for (int dim = 0; dim < DIM; ++dim)
-      if (dim != must_be_inner) {
+      if (!(inner_mask & (1U << dim))) {
         outer_dim_ = dim;
         break;
       }
@@ -84,10 +89,11 @@ struct UnaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
+                  uint32_t collapsed_mask,
                   size_t volume) const
   {
     Splitter<DIM> splitter;
-    auto split = splitter.split(rect, collapsed_dim);
+    auto split = splitter.split(rect, collapsed_mask);
 
 #pragma omp parallel for schedule(static)
     for (size_t o_idx = 0; o_idx < split.outer; ++o_idx) {
@@ -52,8 +52,17 @@ struct UnaryRedImpl {
 
     AccessorRO<bool, DIM> where;
     if constexpr (HAS_WHERE) { where = args.where.read_accessor<bool, DIM>(rect); }
+
+    // The innermost collapsed dimension is the one that argument reductions
+    // record indices along, and the one the GPU kernel iterates over
+    assert(args.collapsed_dims.size() > 0);
+    int collapsed_dim       = args.collapsed_dims[args.collapsed_dims.size() - 1];
+    uint32_t collapsed_mask = 0;
+    for (size_t idx = 0; idx < args.collapsed_dims.size(); ++idx)
+      collapsed_mask |= 1U << args.collapsed_dims[idx];
+
     UnaryRedImplBody<KIND, OP_CODE, CODE, DIM, HAS_WHERE>()(
-      lhs, rhs, where, rect, pitches, args.collapsed_dim, volume);
+      lhs, rhs, where, rect, pitches, collapsed_dim, collapsed_mask, volume);
   }
 
   template <Type::Code CODE,
@@ -86,7 +95,7 @@ static void unary_red_template(TaskContext& context)
   UnaryRedArgs args{reductions[0],
                     inputs[0],
                     has_where ? inputs[1] : dummy_where,
-                    scalars[0].value<int32_t>(),
+                    scalars[0].values<int32_t>(),
                     scalars[1].value<UnaryRedCode>()};
   if (has_where) {
     op_dispatch(args.op_code, UnaryRedDispatch<KIND, true>{}, args);
@@ -19,6 +19,7 @@
 #include "cunumeric/cunumeric.h"
 #include "cunumeric/arg.h"
 #include "cunumeric/arg.inl"
+#include "cunumeric/welford.h"
 #include "cunumeric/unary/isnan.h"
 
 namespace cunumeric {
@@ -293,13 +294,16 @@ struct UnaryRedOp<UnaryRedCode::SUM_SQUARES, TYPE_CODE> {
   __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return rhs * rhs; }
 };
 
+// Accumulates the count, mean, and M2 of the values in a single pass. The variance
+// is extracted from the final state by UnaryOpCode::GETVAR.
 template <legate::Type::Code TYPE_CODE>
 struct UnaryRedOp<UnaryRedCode::VARIANCE, TYPE_CODE> {
-  static constexpr bool valid = true;
+  static constexpr bool valid =
+    TYPE_CODE == legate::Type::Code::FLOAT32 || TYPE_CODE == legate::Type::Code::FLOAT64;
 
   using RHS = legate::legate_type_of<TYPE_CODE>;
-  using VAL = RHS;
-  using OP  = Legion::SumReduction<VAL>;
+  using VAL = WelfordState<RHS>;
+  using OP  = WelfordReduction<RHS>;
 
   template <bool EXCLUSIVE>
   __CUDA_HD__ static void fold(VAL& a, VAL b)
@@ -308,12 +312,12 @@ struct UnaryRedOp<UnaryRedCode::VARIANCE, TYPE_CODE> {
   }
 
   template <int32_t DIM>
-  __CUDA_HD__ static VAL convert(const Legion::Point<DIM>&, int32_t, const VAL, const RHS& rhs)
+  __CUDA_HD__ static VAL convert(const legate::Point<DIM>&, int32_t, const VAL, const RHS& rhs)
   {
-    return rhs * rhs;
+    return VAL(rhs);
   }
 
-  __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return rhs * rhs; }
+  __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return VAL(rhs); }
 };
 
 template <legate::Type::Code TYPE_CODE>
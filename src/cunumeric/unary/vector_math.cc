@@ -0,0 +1,274 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/unary/vector_math.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// Builds a copy of each kernel per instruction set and dispatches to the best one for the
+// host CPU on the first call. Other architectures rely on their baseline vector ISA (e.g.,
+// NEON on AArch64).
+#if defined(__x86_64__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define VECTOR_MATH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+#ifndef VECTOR_MATH_KERNEL
+#define VECTOR_MATH_KERNEL
+#endif
+
+namespace cunumeric {
+namespace vector_math {
+
+namespace {
+
+// Number of elements processed per iteration of the outer loops. The inner loops have
+// a constant trip count, which helps the compiler vectorize them.
+constexpr size_t BLOCK = 64;
+
+template <typename T>
+struct Bits;
+
+template <>
+struct Bits<float> {
+  using Int                              = int32_t;
+  static constexpr int MANTISSA_BITS     = 23;
+  static constexpr Int EXPONENT_BIAS     = 127;
+  static constexpr Int MANTISSA_MASK     = (Int{1} << MANTISSA_BITS) - 1;
+  static constexpr float ROUNDING_SHIFT  = 0x1.8p23f;
+  static constexpr float EXP_OVERFLOW    = 0x1.62e42ep6f;   // log(FLT_MAX)
+  static constexpr float EXP_UNDERFLOW   = -0x1.9fe368p6f;  // log(FLT_TRUE_MIN / 2)
+  static constexpr float EXP2_OVERFLOW   = 128.0f;
+  static constexpr float EXP2_UNDERFLOW  = -150.0f;
+  static constexpr float SUBNORMAL_SCALE = 0x1p25f;
+};
+
+template <>
+struct Bits<double> {
+  using Int                               = int64_t;
+  static constexpr int MANTISSA_BITS      = 52;
+  static constexpr Int EXPONENT_BIAS      = 1023;
+  static constexpr Int MANTISSA_MASK      = (Int{1} << MANTISSA_BITS) - 1;
+  static constexpr double ROUNDING_SHIFT  = 0x1.8p52;
+  static constexpr double EXP_OVERFLOW    = 0x1.62e42fefa39efp9;   // log(DBL_MAX)
+  static constexpr double EXP_UNDERFLOW   = -0x1.74910d52d3052p9;  // log(DBL_TRUE_MIN / 2)
+  static constexpr double EXP2_OVERFLOW   = 1024.0;
+  static constexpr double EXP2_UNDERFLOW  = -1075.0;
+  static constexpr double SUBNORMAL_SCALE = 0x1p54;
+};
+
+template <typename T>
+inline typename Bits<T>::Int to_bits(T value)
+{
+  typename Bits<T>::Int bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+template <typename T>
+inline T from_bits(typename Bits<T>::Int bits)
+{
+  T value;
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
+// Returns 2^n for the exponents of normal numbers
+template <typename T>
+inline T pow2(typename Bits<T>::Int n)
+{
+  using B = Bits<T>;
+  return from_bits<T>((n + B::EXPONENT_BIAS) << B::MANTISSA_BITS);
+}
+
+// Computes p * 2^n for the range of n that exp can produce, splitting the scaling in two
+// steps so that neither factor overflows and subnormal results are rounded only once
+template <typename T>
+inline T scale(T p, typename Bits<T>::Int n)
+{
+  auto half = n >> 1;
+  return p * pow2<T>(half) * pow2<T>(n - half);
+}
+
+// Taylor polynomials of e^r for |r| <= log(2) / 2, evaluated with Horner's scheme
+inline float expm1_poly(float r)
+{
+  return r * (1.0f + r * (1.0f / 2 + r * (1.0f / 6 + r * (1.0f / 24 + r * (1.0f / 120 +
+                                                 r * (1.0f / 720 + r * (1.0f / 5040)))))));
+}
+
+inline double expm1_poly(double r)
+{
+  double p = 1.0 / 6227020800;
+  p        = p * r + 1.0 / 479001600;
+  p        = p * r + 1.0 / 39916800;
+  p        = p * r + 1.0 / 3628800;
+  p        = p * r + 1.0 / 362880;
+  p        = p * r + 1.0 / 40320;
+  p        = p * r + 1.0 / 5040;
+  p        = p * r + 1.0 / 720;
+  p        = p * r + 1.0 / 120;
+  p        = p * r + 1.0 / 24;
+  p        = p * r + 1.0 / 6;
+  p        = p * r + 1.0 / 2;
+  p        = p * r + 1.0;
+  return p * r;
+}
+
+// Cody and Waite's split of log(2), whose high part has enough trailing zeros that
+// multiplying it by the exponent of the reduction is exact
+template <typename T>
+struct Ln2;
+
+template <>
+struct Ln2<float> {
+  static constexpr float HI = 0x1.62e4p-1f;
+  static constexpr float LO = 0x1.7f7d1cp-20f;
+};
+
+template <>
+struct Ln2<double> {
+  static constexpr double HI = 0x1.62e42feep-1;
+  static constexpr double LO = 0x1.a39ef35793c76p-33;
+};
+
+// e^x = 2^n * e^r, where n = round(x / log(2)) and r = x - n * log(2)
+template <typename T>
+inline T exp_kernel(T x)
+{
+  using B  = Bits<T>;
+  using L  = Ln2<T>;
+  T xc     = x > B::EXP_OVERFLOW ? B::EXP_OVERFLOW : x;
+  xc       = xc < B::EXP_UNDERFLOW ? B::EXP_UNDERFLOW : xc;
+  T kd     = xc * static_cast<T>(1.4426950408889634) + B::ROUNDING_SHIFT;
+  auto n   = to_bits(kd) - to_bits(B::ROUNDING_SHIFT);
+  kd       = kd - B::ROUNDING_SHIFT;
+  T r      = (xc - kd * L::HI) - kd * L::LO;
+  T result = scale<T>(1 + expm1_poly(r), n);
+  result   = x > B::EXP_OVERFLOW ? std::numeric_limits<T>::infinity() : result;
+  result   = x < B::EXP_UNDERFLOW ? T{0} : result;
+  return x != x ? x : result;
+}
+
+// 2^x = 2^n * e^r, where n = round(x) and r = (x - n) * log(2)
+template <typename T>
+inline T exp2_kernel(T x)
+{
+  using B  = Bits<T>;
+  T xc     = x > B::EXP2_OVERFLOW ? B::EXP2_OVERFLOW : x;
+  xc       = xc < B::EXP2_UNDERFLOW ? B::EXP2_UNDERFLOW : xc;
+  T kd     = xc + B::ROUNDING_SHIFT;
+  auto n   = to_bits(kd) - to_bits(B::ROUNDING_SHIFT);
+  kd       = kd - B::ROUNDING_SHIFT;
+  T r      = (xc - kd) * static_cast<T>(0.6931471805599453);
+  T result = scale<T>(1 + expm1_poly(r), n);
+  result   = x >= B::EXP2_OVERFLOW ? std::numeric_limits<T>::infinity() : result;
+  result   = x <= B::EXP2_UNDERFLOW ? T{0} : result;
+  return x != x ? x : result;
+}
+
+// Series of (log(1 + f) - f + f^2 / 2) / s - f^2 / 2 in z = s^2, where s = f / (2 + f)
+inline float log_poly(float z)
+{
+  return z * (2.0f / 3 + z * (2.0f / 5 + z * (2.0f / 7 + z * (2.0f / 9 + z * (2.0f / 11)))));
+}
+
+inline double log_poly(double z)
+{
+  double p = 2.0 / 21;
+  p        = p * z + 2.0 / 19;
+  p        = p * z + 2.0 / 17;
+  p        = p * z + 2.0 / 15;
+  p        = p * z + 2.0 / 13;
+  p        = p * z + 2.0 / 11;
+  p        = p * z + 2.0 / 9;
+  p        = p * z + 2.0 / 7;
+  p        = p * z + 2.0 / 5;
+  p        = p * z + 2.0 / 3;
+  return p * z;
+}
+
+// log(x) = e * log(2) + log(1 + f), where x = 2^e * (1 + f) and sqrt(2) / 2 <= 1 + f < sqrt(2).
+// log(1 + f) is computed as in fdlibm, so that the leading term f is exact.
+template <typename T>
+inline T log_kernel(T x)
+{
+  using B        = Bits<T>;
+  using L        = Ln2<T>;
+  using Int      = typename B::Int;
+  bool subnormal = x < std::numeric_limits<T>::min();
+  T xn           = subnormal ? x * B::SUBNORMAL_SCALE : x;
+  Int bits       = to_bits(xn);
+  Int e          = (bits >> B::MANTISSA_BITS) - B::EXPONENT_BIAS;
+  e              = subnormal ? e - (B::MANTISSA_BITS + 2) : e;
+  T m            = from_bits<T>((bits & B::MANTISSA_MASK) | (B::EXPONENT_BIAS << B::MANTISSA_BITS));
+  bool large     = m > static_cast<T>(1.4142135623730951);
+  m              = large ? m * static_cast<T>(0.5) : m;
+  e              = large ? e + 1 : e;
+  T f            = m - 1;
+  T s            = f / (2 + f);
+  T hfsq         = static_cast<T>(0.5) * f * f;
+
+  // Converts the exponent with the rounding shift, as x86 has no vector conversion from
+  // 64-bit integers before AVX-512
+  T ed     = from_bits<T>(to_bits(B::ROUNDING_SHIFT) + e) - B::ROUNDING_SHIFT;
+  T result = ed * L::HI + (f - (hfsq - (s * (hfsq + log_poly(s * s)) + ed * L::LO)));
+  result   = x == std::numeric_limits<T>::infinity() ? x : result;
+  result   = x == 0 ? -std::numeric_limits<T>::infinity() : result;
+  result   = x < 0 ? std::numeric_limits<T>::quiet_NaN() : result;
+  return x != x ? x : result;
+}
+
+template <typename T, typename Kernel>
+inline void apply(const T* in, T* out, size_t volume, Kernel kernel)
+{
+  size_t idx = 0;
+  for (; idx + BLOCK <= volume; idx += BLOCK)
+    for (size_t off = 0; off < BLOCK; ++off) out[idx + off] = kernel(in[idx + off]);
+  for (; idx < volume; ++idx) out[idx] = kernel(in[idx]);
+}
+
+}  // namespace
+
+bool enabled()
+{
+  static const bool fast_math = [] {
+    const char* fast_math = getenv("CUNUMERIC_FAST_MATH");
+    return fast_math != nullptr && atoi(fast_math) > 0;
+  }();
+  return fast_math;
+}
+
+#define DEFINE_KERNEL(NAME, TYPE)                                         \
+  VECTOR_MATH_KERNEL void NAME(const TYPE* in, TYPE* out, size_t volume) \
+  {                                                                       \
+    apply(in, out, volume, [](TYPE x) { return NAME##_kernel(x); });     \
+  }
+
+DEFINE_KERNEL(exp, float)
+DEFINE_KERNEL(exp, double)
+DEFINE_KERNEL(exp2, float)
+DEFINE_KERNEL(exp2, double)
+DEFINE_KERNEL(log, float)
+DEFINE_KERNEL(log, double)
+
+#undef DEFINE_KERNEL
+
+}  // namespace vector_math
+}  // namespace cunumeric
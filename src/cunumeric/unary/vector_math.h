@@ -0,0 +1,65 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cunumeric/unary/unary_op_util.h"
+
+namespace cunumeric {
+
+// Vectorized implementations of transcendental functions for the dense CPU paths of unary
+// operations. The kernels evaluate branch-free polynomial approximations that the compiler
+// turns into SIMD code, and on x86 they are built for AVX-512, AVX2, and the baseline ISA,
+// with the best one picked at load time based on the host CPU. Their results are within 1.5
+// ULPs of the exact ones, rather than matching the system's libm to the bit, so they are only
+// used when CUNUMERIC_FAST_MATH is set.
+namespace vector_math {
+
+// Returns true if the vectorized kernels should be used
+bool enabled();
+
+void exp(const float* in, float* out, size_t volume);
+void exp(const double* in, double* out, size_t volume);
+void exp2(const float* in, float* out, size_t volume);
+void exp2(const double* in, double* out, size_t volume);
+void log(const float* in, float* out, size_t volume);
+void log(const double* in, double* out, size_t volume);
+
+}  // namespace vector_math
+
+// Maps unary operations to their vectorized kernels, if any
+template <UnaryOpCode OP_CODE, legate::Type::Code CODE>
+struct VectorUnaryOp {
+  static constexpr bool valid = false;
+};
+
+#define DEFINE_VECTOR_UNARY_OP(OP_CODE, FUNCTION)                                            \
+  template <legate::Type::Code CODE>                                                         \
+  struct VectorUnaryOp<UnaryOpCode::OP_CODE, CODE> {                                         \
+    static constexpr bool valid =                                                            \
+      CODE == legate::Type::Code::FLOAT32 || CODE == legate::Type::Code::FLOAT64;            \
+    using T = legate::legate_type_of<CODE>;                                                  \
+                                                                                             \
+    static void apply(const T* in, T* out, size_t volume) { FUNCTION(in, out, volume); }     \
+  };
+
+DEFINE_VECTOR_UNARY_OP(EXP, vector_math::exp)
+DEFINE_VECTOR_UNARY_OP(EXP2, vector_math::exp2)
+DEFINE_VECTOR_UNARY_OP(LOG, vector_math::log)
+
+#undef DEFINE_VECTOR_UNARY_OP
+
+}  // namespace cunumeric
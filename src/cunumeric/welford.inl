@@ -0,0 +1,120 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "welford.h"
+
+namespace cunumeric {
+
+template <typename T>
+__CUDA_HD__ WelfordState<T>::WelfordState(T v) : count(1), mean(v), m2(0)
+{
+}
+
+template <typename T>
+__CUDA_HD__ WelfordState<T>::WelfordState(int64_t c, T mn, T m) : count(c), mean(mn), m2(m)
+{
+}
+
+template <typename T>
+__CUDA_HD__ WelfordState<T>::WelfordState(const WelfordState& other)
+  : count(other.count), mean(other.mean), m2(other.m2)
+{
+}
+
+template <typename T>
+__CUDA_HD__ inline void WelfordState<T>::merge(const WelfordState<T>& rhs)
+{
+  if (rhs.count == 0) return;
+  if (count == 0) {
+    *this = rhs;
+    return;
+  }
+  int64_t total = count + rhs.count;
+  T delta       = rhs.mean - mean;
+  T weight      = static_cast<T>(rhs.count) / static_cast<T>(total);
+  mean += delta * weight;
+  m2 += rhs.m2 + delta * delta * static_cast<T>(count) * weight;
+  count = total;
+}
+
+template <typename T>
+template <bool EXCLUSIVE>
+__CUDA_HD__ inline void WelfordState<T>::apply(const WelfordState<T>& rhs)
+{
+  if (EXCLUSIVE) {
+    merge(rhs);
+  } else {
+    // The three fields can't be updated with a single atomic, so we lock the
+    // state by swapping -1 into the count, which is never negative otherwise
+    WelfordState<T> copy;
+#ifdef __CUDA_ARCH__
+    const unsigned long long guard = (unsigned long long)-1LL;
+    unsigned long long* ptr        = (unsigned long long*)&count;
+    union {
+      long long as_signed;
+      unsigned long long as_unsigned;
+    } next, current;
+    next.as_signed = *ptr;
+    do {
+      current.as_signed = next.as_signed;
+      next.as_unsigned  = atomicCAS(ptr, current.as_unsigned, guard);
+    } while ((next.as_signed != current.as_signed) || (next.as_signed == -1LL));
+    // Memory fence to prevent the compiler from hoisting the loads
+    __threadfence();
+    copy = WelfordState<T>(next.as_signed, mean, m2);
+    copy.merge(rhs);
+    mean = copy.mean;
+    m2   = copy.m2;
+    // Memory fence to make sure that the values are visible before we release the lock
+    __threadfence();
+    next.as_signed = copy.count;
+    atomicCAS(ptr, guard, next.as_unsigned);
+#else
+    volatile long long* ptr = reinterpret_cast<volatile long long*>(&count);
+    long long next          = *ptr;
+    long long current;
+    do {
+      current = next;
+      next    = __sync_val_compare_and_swap(ptr, current, -1);
+    } while ((next != current) || (next == -1));
+    // Memory fence to prevent the compiler from hoisting the loads
+    __sync_synchronize();
+    copy = WelfordState<T>(next, mean, m2);
+    copy.merge(rhs);
+    mean = copy.mean;
+    m2   = copy.m2;
+    // Memory fence to make sure that the values are visible before we release the lock
+    __sync_synchronize();
+    __sync_val_compare_and_swap(ptr, -1, copy.count);
+#endif
+  }
+}
+
+// Declare these here, to work around undefined-var-template warnings
+
+#define DECLARE_WELFORD_IDENTITY(TYPE) \
+  template <>                          \
+  const WelfordState<TYPE> WelfordReduction<TYPE>::identity;
+
+DECLARE_WELFORD_IDENTITY(float)
+DECLARE_WELFORD_IDENTITY(double)
+
+#undef DECLARE_WELFORD_IDENTITY
+
+}  // namespace cunumeric
@@ -208,23 +208,27 @@ def test_broadcast_true2(shape_b):
     assert res_np is bool(res_num) is True
 
 
-@pytest.mark.parametrize(
-    "equal_nan", (False, pytest.param(True, marks=pytest.mark.xfail))
-)
+@pytest.mark.parametrize("equal_nan", (False, True))
 @pytest.mark.parametrize(
     "arr",
     ([np.nan], [1, 2, np.nan], [[1, 2], [3, np.nan]]),
     ids=lambda arr: f"(arr={arr})",
 )
 def test_equal_nan_basic(arr, equal_nan):
-    # If equal_nan is True,
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     res_np = np.allclose(arr, arr, equal_nan=equal_nan)
     res_num = num.allclose(arr, arr, equal_nan=equal_nan)
     assert res_np == res_num
 
 
+@pytest.mark.parametrize("equal_nan", (False, True))
+def test_equal_nan_mismatch(equal_nan):
+    a = np.array([1.0, np.nan, 3.0, np.inf])
+    b = np.array([1.0, 2.0, np.nan, np.inf])
+    res_np = np.allclose(a, b, equal_nan=equal_nan)
+    res_num = num.allclose(a, b, equal_nan=equal_nan)
+    assert res_np is bool(res_num) is False
+
+
 EMPTY_ARRAY_PAIRS = (
     ([], []),
     ([], [[]]),
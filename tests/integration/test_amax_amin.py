@@ -91,13 +91,10 @@ def test_axis(func_name, ndim, keepdims, initial):
         assert np.array_equal(res_np, res_num)
 
 
-@pytest.mark.xfail
 @pytest.mark.parametrize("axes", ((-3, -1), (-1, 0), (-2, 2), (0, 2)))
 @pytest.mark.parametrize("keepdims", [True, False])
 @pytest.mark.parametrize("func_name", FUNCS)
 def test_axis_tuple(func_name, keepdims, axes):
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     shape = (3, 4, 5)
     in_np = np.random.randint(-5, 5, size=shape)
     in_num = num.array(in_np)
@@ -161,6 +161,48 @@ class TestArgSort(object):
             res_num = num.argsort(arr_num, axis=axis, kind=sort_type)
             assert np.array_equal(res_num, res_np)
 
+    @pytest.mark.parametrize("segment_size", (2, 32, 33, 1000))
+    @pytest.mark.parametrize("sort_type", STABLE_SORT_TYPES)
+    def test_many_segments(self, segment_size, sort_type):
+        # Many short segments are sorted concurrently, and the shortest
+        # ones by insertion, which must keep ties in order
+        shape = (20_000 // segment_size, segment_size)
+        arr_np = np.random.randint(-10, 10, shape)
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, axis=-1, kind=sort_type)
+        res_num = num.argsort(arr_num, axis=-1, kind=sort_type)
+        assert np.array_equal(res_num, res_np)
+
+    @pytest.mark.parametrize("shape", ((100_000,), (20, 5000)))
+    @pytest.mark.parametrize(
+        "dtype",
+        (np.bool_, np.int8, np.uint16, np.int64, np.float16, np.float64),
+    )
+    def test_radix_sortable(self, shape, dtype):
+        # Long segments of these types are radix sorted, which must order
+        # negative numbers and NaNs the way NumPy does
+        arr_np = np.random.randint(-50, 50, shape).astype(dtype)
+        if np.issubdtype(dtype, np.floating):
+            arr_np[..., ::11] = np.nan
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, axis=-1, kind="stable")
+        res_num = num.argsort(arr_num, axis=-1, kind="stable")
+        assert np.array_equal(res_num, res_np)
+        res_np = np.sort(arr_np, axis=-1)
+        res_num = num.sort(arr_num, axis=-1)
+        assert np.array_equal(res_num, res_np, equal_nan=True)
+
+    @pytest.mark.parametrize("shape", ((1_000_000,), (3, 400_000)))
+    @pytest.mark.parametrize("dtype", (np.int32, np.complex64))
+    def test_merge_ties(self, shape, dtype):
+        # When the sort axis is split across processors, the sorted pieces
+        # are merged in chunks, which must keep ties in order across them
+        arr_np = np.random.randint(0, 4, shape).astype(dtype)
+        arr_num = num.array(arr_np)
+        res_np = np.argsort(arr_np, axis=-1, kind="stable")
+        res_num = num.argsort(arr_num, axis=-1, kind="stable")
+        assert np.array_equal(res_num, res_np)
+
     @pytest.mark.parametrize("size", SIZES)
     def test_arr_basic_axis(self, size):
         arr_np = np.random.randint(-100, 100, size)
@@ -52,6 +52,17 @@ def test_unequal_arrays(arr1, arr2):
     assert res_np_swapped is bool(res_num_swapped) is False
 
 
+@pytest.mark.parametrize("position", (0, 50_000, -1))
+def test_single_mismatch(position):
+    # Large enough to span several blocks of the early-exit loops
+    arr1 = np.arange(100_000)
+    arr2 = arr1.copy()
+    arr2[position] = -1
+    assert not num.array_equal(num.array(arr1), num.array(arr2))
+    assert num.array_equal(num.array(arr1), num.array(arr1))
+    assert num.array_equal(num.array(arr1)[::2], num.array(arr1)[::2])
+
+
 DTYPES = (
     (np.int32, np.float64),
     (np.float64, np.complex128),
@@ -75,30 +86,20 @@ def test_equal_values_with_different_dtype(dtype1, dtype2):
     assert res_np_swapped == res_num_swapped
 
 
-@pytest.mark.parametrize(
-    "equal_nan", (False, pytest.param(True, marks=pytest.mark.xfail))
-)
+@pytest.mark.parametrize("equal_nan", (False, True))
 @pytest.mark.parametrize(
     "arr",
     ([np.nan], [1, 2, np.nan], [[1, 2], [3, np.nan]]),
     ids=lambda arr: f"(arr={arr})",
 )
 def test_equal_nan_basic(arr, equal_nan):
-    # If equal_nan is True,
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     res_np = np.array_equal(arr, arr, equal_nan=equal_nan)
     res_num = num.array_equal(arr, arr, equal_nan=equal_nan)
     assert res_np == res_num
 
 
-@pytest.mark.parametrize(
-    "equal_nan", (False, pytest.param(True, marks=pytest.mark.xfail))
-)
+@pytest.mark.parametrize("equal_nan", (False, True))
 def test_equal_nan_complex_values(equal_nan):
-    # If equal_nan is True,
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     a = np.array([1, 1 + 1j])
     b = a.copy()
     a.real = np.nan
@@ -109,6 +110,21 @@ def test_equal_nan_complex_values(equal_nan):
     assert res_np == res_num
 
 
+@pytest.mark.parametrize("equal_nan", (False, True))
+def test_complex_infinities(equal_nan):
+    a = np.array([1 + 1j, complex(np.inf, 0), complex(1, -np.inf)])
+    b = a.copy()
+    c = a.copy()
+    c[1] = complex(np.inf, 1)
+
+    for other in (b, c):
+        res_np = np.array_equal(a, other, equal_nan=equal_nan)
+        res_num = num.array_equal(
+            num.array(a), num.array(other), equal_nan=equal_nan
+        )
+        assert res_np == res_num
+
+
 if __name__ == "__main__":
     import sys
 
@@ -67,6 +67,22 @@ def test_random(shape, ndim):
             assert num.array_equal(x + y, a + b)
 
 
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+@pytest.mark.parametrize("ndim", DIMS)
+def test_scalar(shape, ndim):
+    local_shape = shape[:ndim]
+    x = num.random.random(local_shape)
+    a = x.__array__()
+
+    assert num.array_equal(x * 2.0, a * 2.0)
+    assert num.array_equal(2.0 - x, 2.0 - a)
+    assert num.array_equal(x / num.array(3.0), a / np.array(3.0))
+
+    # A scalar operand combined with a non-dense one
+    assert num.array_equal(x.T - 1.0, a.T - 1.0)
+    assert num.array_equal(x[..., ::2] * 2.0, a[..., ::2] * 2.0)
+
+
 if __name__ == "__main__":
     import sys
 
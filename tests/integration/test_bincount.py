@@ -22,6 +22,8 @@ import cunumeric as num
 N = 8000
 MAX_VAL = 9
 LARGE_NUM_BINS = 20000
+# More bins than the CPU variants keep in private copies per thread
+HUGE_NUM_BINS = 5_000_000
 
 DTYPES = [np.int64, np.int32, np.int16]
 MINLENGTHS = [0, 5, 15]
@@ -161,6 +163,22 @@ def test_bincount_weights_high_bins(dtype):
     assert allclose(out_np, out_num)
 
 
+@pytest.mark.parametrize("size", (1000, 1_000_000))
+@pytest.mark.parametrize("weighted", (False, True))
+def test_bincount_huge_bins(size, weighted):
+    # Covers both the sparse inputs that are sorted by bin and the dense ones
+    # that are reduced straight into the bins
+    v_np = np.random.randint(0, HUGE_NUM_BINS, size=size)
+    w_np = np.random.randn(size) if weighted else None
+    v_num = num.array(v_np)
+    w_num = num.array(w_np) if weighted else None
+
+    out_np = np.bincount(v_np, weights=w_np, minlength=HUGE_NUM_BINS)
+    out_num = num.bincount(v_num, weights=w_num, minlength=HUGE_NUM_BINS)
+
+    assert allclose(out_np, out_num)
+
+
 @pytest.mark.parametrize(
     "weights",
     [
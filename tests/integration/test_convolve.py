@@ -24,8 +24,9 @@ import cunumeric as num
 
 CUDA_TEST = os.environ.get("LEGATE_NEED_CUDA") == "1"
 
-SHAPES = [(100,), (10, 10), (10, 10, 10), (32, 2, 32)]
-FILTER_SHAPES = [(5,), (3, 5), (3, 5, 3), (32, 1, 32)]
+# The last pair is large enough for the host variants to pick the FFT path
+SHAPES = [(100,), (10, 10), (10, 10, 10), (32, 2, 32), (256, 256)]
+FILTER_SHAPES = [(5,), (3, 5), (3, 5, 3), (32, 1, 32), (31, 31)]
 
 LARGE_SHAPES = [
     pytest.param(
@@ -153,25 +154,36 @@ def test_dtype(dtype):
     assert allclose(out_num, out_np)
 
 
-@pytest.mark.parametrize(
-    "mode",
-    [
-        ("same"),
-        pytest.param("valid", marks=pytest.mark.xfail),
-        pytest.param("full", marks=pytest.mark.xfail),
-    ],
-)
+@pytest.mark.parametrize("mode", ["same", "valid", "full"])
 def test_modes(mode):
     shape = (5,) * 2
     arr1 = num.random.random(shape)
     arr2 = num.random.random(shape)
     out_num = num.convolve(arr1, arr2, mode=mode)
-    # when mode!="same", cunumeric raises
-    # NotImplementedError: Need to implement other convolution modes
     out_np = np.convolve(arr1, arr2, mode=mode)
     assert allclose(out_num, out_np)
 
 
+@pytest.mark.parametrize("mode", ["valid", "full"])
+@pytest.mark.parametrize(
+    "shape, filter_shape", list(zip(SHAPES, FILTER_SHAPES)), ids=str
+)
+def test_modes_nd(shape, filter_shape, mode):
+    a = num.random.rand(*shape)
+    v = num.random.rand(*filter_shape)
+    anp = a.__array__()
+    vnp = v.__array__()
+
+    out_num = num.convolve(a, v, mode=mode)
+    if a.ndim > 1:
+        out_np = sig.convolve(anp, vnp, mode=mode)
+    else:
+        out_np = np.convolve(anp, vnp, mode=mode)
+
+    assert out_num.shape == out_np.shape
+    assert allclose(out_num, out_np)
+
+
 @pytest.mark.parametrize(
     "ndim",
     [
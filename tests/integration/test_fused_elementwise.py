@@ -0,0 +1,150 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+from cunumeric.settings import settings
+
+SHAPE = (17, 33)
+
+
+@pytest.fixture(autouse=True)
+def fuse_elementwise():
+    settings.fuse_elementwise = True
+    yield
+    settings.fuse_elementwise.unset_value()
+
+
+def make_inputs(count, shape=SHAPE, dtype=np.float64):
+    rng = np.random.default_rng(count)
+    arrs_np = [
+        rng.uniform(0.5, 1.5, size=shape).astype(dtype) for _ in range(count)
+    ]
+    return arrs_np, [num.array(arr) for arr in arrs_np]
+
+
+@pytest.mark.parametrize("dtype", (np.float32, np.float64))
+def test_chain(dtype):
+    (a_np, b_np, c_np), (a_num, b_num, c_num) = make_inputs(3, dtype=dtype)
+
+    out_np = (a_np + b_np) * c_np - a_np / 2
+    out_num = (a_num + b_num) * c_num - a_num / 2
+
+    assert out_num.dtype == out_np.dtype
+    assert np.allclose(out_num, out_np)
+
+
+def test_unary_ops():
+    (a_np, b_np), (a_num, b_num) = make_inputs(2)
+
+    out_np = np.sqrt(np.abs(-a_np) + np.exp(-np.square(b_np))) - np.log(a_np)
+    out_num = (
+        num.sqrt(num.abs(-a_num) + num.exp(-num.square(b_num)))
+        - num.log(a_num)
+    )
+
+    assert np.allclose(out_num, out_np)
+
+
+def test_maximum_minimum():
+    (a_np, b_np, c_np), (a_num, b_num, c_num) = make_inputs(3)
+
+    out_np = np.maximum(np.minimum(a_np, b_np), c_np * 0.75)
+    out_num = num.maximum(num.minimum(a_num, b_num), c_num * 0.75)
+
+    assert np.allclose(out_num, out_np)
+
+
+def test_broadcast():
+    (a_np,), (a_num,) = make_inputs(1)
+    (row_np,), (row_num,) = make_inputs(1, shape=SHAPE[-1:])
+    (col_np,), (col_num,) = make_inputs(1, shape=SHAPE[:1] + (1,))
+
+    out_np = (a_np - row_np) * (col_np + 1) + row_np
+    out_num = (a_num - row_num) * (col_num + 1) + row_num
+
+    assert np.allclose(out_num, out_np)
+
+
+def test_intermediates_kept():
+    (a_np, b_np), (a_num, b_num) = make_inputs(2)
+
+    t_np = a_np + b_np
+    t_num = a_num + b_num
+    u_np = t_np * t_np - b_np
+    u_num = t_num * t_num - b_num
+
+    assert np.allclose(u_num, u_np)
+    assert np.allclose(t_num, t_np)
+
+
+def test_in_place():
+    (a_np, b_np), (a_num, b_num) = make_inputs(2)
+
+    x_np = a_np * b_np
+    x_num = a_num * b_num
+    x_np += a_np
+    x_num += a_num
+    a_np *= 2
+    a_num *= 2
+    y_np = x_np - a_np
+    y_num = x_num - a_num
+
+    assert np.allclose(y_num, y_np)
+    assert np.allclose(x_num, x_np)
+    assert np.allclose(a_num, a_np)
+
+
+def test_long_chain():
+    (a_np, b_np), (a_num, b_num) = make_inputs(2)
+
+    # Longer than a single fused expression can be
+    out_np = a_np
+    out_num = a_num
+    for _ in range(40):
+        out_np = out_np * 0.5 + b_np
+        out_num = out_num * 0.5 + b_num
+
+    assert np.allclose(out_num, out_np)
+
+
+def test_mixed_dtypes():
+    (a_np,), (a_num,) = make_inputs(1, dtype=np.float32)
+    (b_np,), (b_num,) = make_inputs(1, dtype=np.float64)
+    c_np = np.arange(SHAPE[-1])
+    c_num = num.arange(SHAPE[-1])
+
+    out_np = (a_np + b_np) * c_np + (a_np * 2)
+    out_num = (a_num + b_num) * c_num + (a_num * 2)
+
+    assert out_num.dtype == out_np.dtype
+    assert np.allclose(out_num, out_np)
+
+
+def test_reduction_of_chain():
+    (a_np, b_np), (a_num, b_num) = make_inputs(2)
+
+    out_np = np.sum(a_np * b_np + 1, axis=0)
+    out_num = num.sum(a_num * b_num + 1, axis=0)
+
+    assert np.allclose(out_num, out_np)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -204,6 +204,32 @@ def test_histogram_singleton_empty(src, bins):
     assert allclose(np_bins_out, num_bins_out, atol=eps)
 
 
+# More bins than the threads can each keep a private copy of
+@pytest.mark.parametrize("num_bins", (100, 5_000_000))
+@pytest.mark.parametrize("weighted", (False, True))
+@pytest.mark.parametrize("ranges", (None, (0.1, 0.9)))
+def test_histogram_uniform_bins_large(weighted, ranges, num_bins):
+    eps = 1.0e-8
+    rng = np.random.default_rng(42)
+    # Includes values outside of the range and on both of its ends
+    src_array = np.concatenate(
+        (rng.uniform(0.0, 1.0, size=100_000), [0.0, 0.1, 0.9, 1.0])
+    )
+    weights_array = (
+        rng.uniform(0.0, 1.0, size=src_array.shape) if weighted else None
+    )
+
+    np_out, np_bins_out = np.histogram(
+        src_array, num_bins, range=ranges, weights=weights_array
+    )
+    num_out, num_bins_out = num.histogram(
+        src_array, num_bins, range=ranges, weights=weights_array
+    )
+
+    assert allclose(np_out, num_out, atol=eps)
+    assert allclose(np_bins_out, num_bins_out, atol=eps)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -237,13 +237,8 @@ def test_isclose_arrays_rtol_atol(rtol, atol):
     assert np.array_equal(out_np, out_num)
 
 
-@pytest.mark.parametrize(
-    "equal_nan", (False, pytest.param(True, marks=pytest.mark.xfail))
-)
+@pytest.mark.parametrize("equal_nan", (False, True))
 def test_isclose_euqal_nan(equal_nan):
-    # If equal_nan is True,
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     values = [np.inf, -np.inf, np.nan, 0.0, -0.0]
     pairs = tuple(combinations_with_replacement(values, 2))
     in1_np = np.array([x for x, _ in pairs])
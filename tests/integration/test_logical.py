@@ -57,15 +57,11 @@ def test_basic(func, input, keepdims):
 
 @pytest.mark.parametrize(
     "axes",
-    ((0,), (1, 2), pytest.param((-1, 0), marks=pytest.mark.xfail), (-1, 0, 1)),
+    ((0,), (1, 2), (-1, 0), (-1, 0, 1)),
     ids=lambda axes: f"(axes={axes})",
 )
 @pytest.mark.parametrize("func", FUNCTIONS)
 def test_axis_tuple(func, axes):
-    # For axes=(-1, 0),
-    # in Numpy, it pass
-    # in cuNumeric, raises ValueError:
-    # Invalid promotion on dimension 2 for a 1-D store
     input = [[[5, 10], [0, 100]]]
     in_np = np.array(input)
     in_num = num.array(in_np)
@@ -102,6 +98,24 @@ def test_nd_inputs(ndim, func):
         assert np.array_equal(out_np, out_num)
 
 
+# Large enough to span several blocks of the early-exit loops
+DECIDING_SIZE = 100_000
+
+
+@pytest.mark.parametrize("position", (0, DECIDING_SIZE // 2, -1))
+@pytest.mark.parametrize("func", FUNCTIONS)
+def test_single_deciding_element(func, position):
+    # ALL is decided by a single false value and ANY by a single true one
+    in_np = np.full(DECIDING_SIZE, func == "all")
+    in_np[position] = func != "all"
+    in_num = num.array(in_np)
+
+    fn_np = getattr(np, func)
+    fn_num = getattr(num, func)
+    assert fn_np(in_np) == fn_num(in_num)
+    assert fn_np(in_np[::2]) == fn_num(in_num[::2])
+
+
 def test_where():
     y = np.array([[True, False], [True, True]])
     cy = num.array(y)
@@ -99,11 +99,8 @@ def test_where_broadcast(size):
     assert np.array_equal(res_np, res_num, equal_nan=True)
 
 
-@pytest.mark.xfail
 @pytest.mark.parametrize("axis", ((-3, -1), (-1, 0), (-2, 2), (0, 2)))
 def test_axis_tuple(axis):
-    # In Numpy, it pass
-    # In cuNumeric, it raises NotImplementedError
     size = (3, 4, 7)
     arr_np = np.random.randint(-5, 5, size=size)
     arr_num = num.array(arr_np)
@@ -86,19 +86,13 @@ def test_axis_out_bound():
         num.count_nonzero(arr, axis=2)
 
 
-@pytest.mark.xfail
 @pytest.mark.parametrize("axis", ((-1, 1), (0, 1), (1, 2), (0, 2)))
 def test_axis_tuple(axis):
     size = (5, 5, 5)
     arr_np = np.random.randint(-5, 5, size=size)
     arr_num = num.array(arr_np)
     out_np = np.count_nonzero(arr_np, axis=axis)
-    # Numpy passed all axis values
     out_num = num.count_nonzero(arr_num, axis=axis)
-    # For (-1, 1), cuNumeric raises 'ValueError:
-    # Invalid promotion on dimension 2 for a 1-D store'
-    # For the others, cuNumeric raises 'NotImplementedError:
-    # Need support for reducing multiple dimensions'
     assert np.array_equal(out_np, out_num)
 
 
@@ -163,6 +163,30 @@ def test_dtypes(shape, dtype):
     check_api(generate_random(shape, dtype))
 
 
+@pytest.mark.parametrize("axis", (0, -1, None))
+@pytest.mark.parametrize("kth", ((1, 4), (-1, 0, 3), (2, 2, -2)))
+def test_multiple_kth(kth, axis):
+    a_np = generate_random((6, 13), np.float64)
+    a_num = num.array(a_np)
+    check_axis = 0 if axis is None else axis
+    size = a_np.size if axis is None else a_np.shape[axis]
+    kths = np.array(kth) % size
+
+    out = num.partition(a_num, kth, axis=axis)
+    expected = np.sort(a_np, axis=axis)
+    assert np.array_equal(
+        np.take(out, kths, axis=check_axis),
+        np.take(expected, kths, axis=check_axis),
+    )
+    for k in kths:
+        assert_partition(out, k, check_axis)
+
+    indices = num.argpartition(a_num, kth, axis=axis)
+    a_org = a_num.flatten() if axis is None else a_num
+    for k in kths:
+        assert_argpartition(indices, a_org, k, check_axis)
+
+
 class TestPartitionErrors:
     def setup_method(self):
         shape = (3, 4, 5)
@@ -179,12 +203,8 @@ class TestPartitionErrors:
         with pytest.raises(expected_exc):
             num.partition(self.a_num, kth=kth, axis=axis)
 
-    @pytest.mark.xfail
     @pytest.mark.parametrize("kth", (-4, 3, (-4, 0), (0, 3), (3, 3)))
     def test_kth_out_of_bound(self, kth):
-        # For all cases,
-        # In numpy, it raises ValueError
-        # In cunumeric, it pass
         expected_exc = ValueError
         axis = 0
         with pytest.raises(expected_exc):
@@ -209,12 +229,8 @@ class TestArgPartitionErrors:
         with pytest.raises(expected_exc):
             num.argpartition(self.a_num, kth=kth, axis=axis)
 
-    @pytest.mark.xfail
     @pytest.mark.parametrize("kth", (-4, 3, (-4, 0), (0, 3), (3, 3)))
     def test_kth_out_of_bound(self, kth):
-        # For all cases,
-        # In numpy, it raises ValueError
-        # In cunumeric, it pass
         expected_exc = ValueError
         axis = 0
         with pytest.raises(expected_exc):
@@ -235,7 +235,6 @@ class TestProdPositive(object):
         out_np = np.prod(arr_np, axis=axis)
         assert allclose(out_np, out_num)
 
-    @pytest.mark.xfail(reason="cunumeric raises exceptions when LEGATE_TEST=1")
     @pytest.mark.parametrize(
         "axis", ((-1, 1), (0, 1), (1, 2), (0, 2)), ids=str
     )
@@ -244,11 +243,6 @@ class TestProdPositive(object):
         arr_np = np.random.random(size) * 10
         arr_num = num.array(arr_np)
         out_np = np.prod(arr_np, axis=axis)
-        # when LEGATE_TEST = 1 cuNumeric raises two types of exceptions
-        # (-1, 1): ValueError: Invalid promotion on dimension 2 for a 1-D store
-        # others:
-        # NotImplementedError: Need support for reducing multiple dimensions
-        # Numpy get results.
         out_num = num.prod(arr_num, axis=axis)
         assert allclose(out_np, out_num)
 
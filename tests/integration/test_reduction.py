@@ -95,16 +95,12 @@ class TestSumNegative(object):
         with pytest.raises(np.AxisError, match=msg):
             num.sum(arr, axis=2)
 
-    @pytest.mark.xfail
     @pytest.mark.parametrize("axis", ((-1, 1), (0, 1), (1, 2), (0, 2)))
     def test_axis_tuple(self, axis):
         size = (5, 5, 5)
         arr_np = np.random.random(size) * 10
         arr_num = num.array(arr_np)
         out_np = np.sum(arr_np, axis=axis)
-        # cuNumeric raises NotImplementedError:
-        # 'Need support for reducing multiple dimensions'
-        # Numpy get results
         out_num = num.sum(arr_num, axis=axis)
         assert allclose(out_np, out_num)
 
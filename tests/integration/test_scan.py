@@ -198,6 +198,48 @@ def test_scan_nan(op, outtype, dt, n0):
     _run_tests(op, n0, shape, dt, axis, out0, outtype)
 
 
+@pytest.mark.parametrize("op", ("cumsum", "nancumsum"))
+@pytest.mark.parametrize("shape", ((20_000, 16), (2, 200_000)))
+def test_many_short_and_few_long_rows(op, shape):
+    # Short rows are scanned in parallel across rows, long ones within a row
+    in_np = np.random.randint(0, 10, size=shape).astype(np.float64)
+    in_np[0, 1] = np.nan
+    in_num = num.array(in_np)
+    out_np = getattr(np, op)(in_np, axis=-1)
+    out_num = getattr(num, op)(in_num, axis=-1)
+    assert np.array_equal(out_np, out_num, equal_nan=True)
+
+
+@pytest.mark.parametrize("op", ("cumsum", "nancumsum", "cumprod"))
+@pytest.mark.parametrize("axis", (0, 1))
+def test_prefix_across_partitions(op, axis):
+    # Long enough along both axes to be split into several partitions, so
+    # that the rows start from the totals of the partitions before them
+    in_np = np.random.uniform(0.5, 1.5, size=(300, 4000))
+    in_np[1, 2] = np.nan
+    in_num = num.array(in_np)
+    out_np = getattr(np, op)(in_np, axis=axis)
+    out_num = getattr(num, op)(in_num, axis=axis)
+    assert np.allclose(out_np, out_num, equal_nan=True)
+
+
+@pytest.mark.parametrize("op", ("cumsum", "nancumprod"))
+@pytest.mark.parametrize("axis", (0, 1, 2))
+@pytest.mark.parametrize("transpose", (False, True))
+def test_any_axis_any_layout(op, axis, transpose):
+    # Scans along leading axes run on the natural layout of the array,
+    # including views whose last axis is not the contiguous one
+    in_np = np.random.uniform(0.5, 1.5, size=(40, 30, 50))
+    in_np[3, 4, 5] = np.nan
+    in_num = num.array(in_np)
+    if transpose:
+        in_np = in_np.transpose(2, 0, 1)
+        in_num = in_num.transpose(2, 0, 1)
+    out_np = getattr(np, op)(in_np, axis=axis)
+    out_num = getattr(num, op)(in_num, axis=axis)
+    assert np.allclose(out_np, out_num, equal_nan=True)
+
+
 @pytest.mark.parametrize("op", ops)
 def test_empty_inputs(op):
     in_np = np.ones(10)
@@ -101,6 +101,16 @@ class TestSort(object):
             res_num = num.sort(arr_num, axis=axis, kind=sort_type)
             assert np.array_equal(res_num, res_np)
 
+    @pytest.mark.parametrize("segment_size", (2, 32, 33, 1000))
+    @pytest.mark.parametrize("sort_type", SORT_TYPES)
+    def test_many_segments(self, segment_size, sort_type):
+        shape = (20_000 // segment_size, segment_size)
+        arr_np = np.random.randint(-100, 100, shape)
+        arr_num = num.array(arr_np)
+        res_np = np.sort(arr_np, axis=-1, kind=sort_type)
+        res_num = num.sort(arr_num, axis=-1, kind=sort_type)
+        assert np.array_equal(res_num, res_np)
+
     @pytest.mark.skip
     @pytest.mark.parametrize("size", SIZES)
     def test_arr_basic_axis(self, size):
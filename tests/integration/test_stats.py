@@ -191,6 +191,32 @@ def test_var_corners(dtype, ddof, axis, shape):
     check_op(op_np, op_num, np_in, dtype)
 
 
+@pytest.mark.parametrize("dtype", dtypes)
+@pytest.mark.parametrize("ddof", [0, 1])
+@pytest.mark.parametrize("axis", [(0, 2), (-1, 0), (0, 1, 2)])
+@pytest.mark.parametrize("keepdims", [False, True])
+def test_var_axis_tuple(dtype, ddof, axis, keepdims):
+    np_in = get_op_input(astype=dtype, shape=(2, 3, 4))
+
+    op_np = functools.partial(np.var, ddof=ddof, axis=axis, keepdims=keepdims)
+    op_num = functools.partial(
+        num.var, ddof=ddof, axis=axis, keepdims=keepdims
+    )
+
+    check_op(op_np, op_num, np_in, dtype)
+
+
+@pytest.mark.parametrize("axis", [None, 0, 1])
+def test_var_large_offset(axis):
+    # A naive <x^2> - <x>^2 loses every significant digit here
+    np_in = get_op_input(shape=(100, 50), offset=1e9)
+
+    op_np = functools.partial(np.var, axis=axis)
+    op_num = functools.partial(num.var, axis=axis)
+
+    check_op(op_np, op_num, np_in, "d")
+
+
 @pytest.mark.xfail
 @pytest.mark.parametrize("dtype", dtypes)
 @pytest.mark.parametrize("ddof", [0, 1])
@@ -42,6 +42,54 @@ def test_ndim(ndim):
     assert np.array_equal(b, b_np)
 
 
+@pytest.mark.parametrize("dtype", (np.int64, np.float64, np.complex128))
+@pytest.mark.parametrize("return_inverse", (True, False))
+@pytest.mark.parametrize("return_counts", (True, False))
+def test_inverse_and_counts(return_inverse, return_counts, dtype):
+    # Many duplicates of a few keys, as well as keys that appear only once
+    arr_np = (
+        np.concatenate(
+            (np.random.randint(0, 7, size=99_990), np.arange(100, 110))
+        )
+        .reshape(-1, 10)
+        .astype(dtype)
+    )
+    if not np.issubdtype(dtype, np.integer):
+        # All NaNs map to the single NaN at the end of the unique values
+        arr_np[::3, 1] = np.nan
+    arr_num = num.array(arr_np)
+
+    res_np = np.unique(
+        arr_np, return_inverse=return_inverse, return_counts=return_counts
+    )
+    res_num = num.unique(
+        arr_num, return_inverse=return_inverse, return_counts=return_counts
+    )
+    if not (return_inverse or return_counts):
+        res_np, res_num = (res_np,), (res_num,)
+    assert len(res_np) == len(res_num)
+    for out_np, out_num in zip(res_np, res_num):
+        assert np.array_equal(np.ravel(out_np), out_num, equal_nan=True)
+
+
+def test_float_keys():
+    arr_np = np.random.randint(0, 50, size=10_000) / 4.0 - 5.0
+    arr_num = num.array(arr_np)
+    assert np.array_equal(np.unique(arr_np), num.unique(arr_num))
+
+
+@pytest.mark.parametrize("dtype", (np.float32, np.float64, np.complex128))
+def test_nan_keys(dtype):
+    # All NaNs collapse into a single one at the end
+    arr_np = (np.random.randint(0, 10, size=10_000) / 2.0).astype(dtype)
+    arr_np[::7] = np.nan
+    arr_num = num.array(arr_np)
+    res_np = np.unique(arr_np)
+    res_num = num.unique(arr_num)
+    assert np.isnan(res_np[-1]) and not np.isnan(res_np[:-1]).any()
+    assert np.array_equal(res_num, res_np, equal_nan=True)
+
+
 @pytest.mark.xfail
 @pytest.mark.parametrize("return_index", (True, False))
 @pytest.mark.parametrize("return_inverse", (True, False))
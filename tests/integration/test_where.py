@@ -70,6 +70,28 @@ def test_broadcast(shape_a):
     )
 
 
+@pytest.mark.parametrize(
+    "x, y",
+    ((0.5, "array"), ("array", 0.5), (1.0, 0.0)),
+    ids=str,
+)
+def test_scalar_inputs(x, y):
+    shape = (4, 5)
+    a_num = mk_seq_array(num, shape)
+    a_np = mk_seq_array(np, shape)
+    cond_num = a_num % 3 == 0
+    cond_np = a_np % 3 == 0
+
+    x_np = a_np * 10.0 if x == "array" else x
+    y_np = a_np * 10.0 if y == "array" else y
+    x_num = a_num * 10.0 if x == "array" else x
+    y_num = a_num * 10.0 if y == "array" else y
+
+    assert np.array_equal(
+        np.where(cond_np, x_np, y_np), num.where(cond_num, x_num, y_num)
+    )
+
+
 @pytest.mark.xfail
 def test_condition_none():
     # In Numpy, pass and returns [1, 2]
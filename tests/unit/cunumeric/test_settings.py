@@ -29,6 +29,7 @@ _expected_settings = (
     "report_dump_callstack",
     "report_dump_csv",
     "numpy_compat",
+    "fuse_elementwise",
     "fast_math",
     "min_gpu_chunk",
     "min_cpu_chunk",
@@ -71,6 +72,7 @@ class TestSettings:
         )
         assert m.settings.report_dump_csv.convert_type == "str"
         assert m.settings.numpy_compat.convert_type == 'bool ("0" or "1")'
+        assert m.settings.fuse_elementwise.convert_type == 'bool ("0" or "1")'
 
 
 class TestDefaults:
@@ -92,6 +94,9 @@ class TestDefaults:
     def test_numpy_compat(self) -> None:
         assert m.settings.numpy_compat.default is False
 
+    def test_fuse_elementwise(self) -> None:
+        assert m.settings.fuse_elementwise.default is False
+
     @pytest.mark.skip(reason="Does not work in CI (path issue)")
     @pytest.mark.parametrize("name", _settings_with_test_defaults)
     def test_default(self, name: str) -> None: